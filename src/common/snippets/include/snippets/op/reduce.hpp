@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface ReduceBase
+ * @brief Generated by Canonicalization for reductions along the innermost dimension. The op updates an accumulator
+ *        with "count" elements of its input on every Tile iteration and the accumulator is reduced horizontally
+ *        once the whole row is processed, so the output has 1 as the innermost dimension.
+ *        Count 0 stands for the whole vector register, the scalar Tile sets it to 1.
+ * @ingroup snippets
+ */
+class ReduceBase : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ReduceBase", "SnippetsOpset");
+
+    ReduceBase(const Output<Node>& x, const size_t count = 0lu);
+    ReduceBase() = default;
+
+    size_t get_count() const { return m_count; }
+
+    void set_count(const size_t count) { m_count = count; }
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+protected:
+    size_t m_count = 0lu;
+};
+
+/**
+ * @interface ReduceMax
+ * @brief Maximum of the input along the innermost dimension
+ * @ingroup snippets
+ */
+class ReduceMax : public ReduceBase {
+public:
+    OPENVINO_OP("ReduceMax", "SnippetsOpset", ReduceBase);
+
+    ReduceMax(const Output<Node>& x, const size_t count = 0lu);
+    ReduceMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+/**
+ * @interface ReduceSum
+ * @brief Sum of the input along the innermost dimension
+ * @ingroup snippets
+ */
+class ReduceSum : public ReduceBase {
+public:
+    OPENVINO_OP("ReduceSum", "SnippetsOpset", ReduceBase);
+
+    ReduceSum(const Output<Node>& x, const size_t count = 0lu);
+    ReduceSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
@@ -96,6 +96,10 @@ public:
     snippets::Schedule generate(const void* compile_params = nullptr);
     Shape canonicalize(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes);
 
+    // true if the body contains ops that reduce along the innermost dimension (Softmax, MVN or reductions),
+    // so the plugin has to keep the layout planar and the innermost dimension intact
+    bool has_domain_sensitive_ops() const;
+
     // plugin sets generator for a snippet to some specific generator.
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ngraph::snippets::Generator> generator);
@@ -16,20 +16,24 @@ namespace op {
  * @interface TileScheduler
  * @brief Contains a set of Tiles (currently one vector and one scalar) and performs necessary preparations
  * before the Tiles could be executed: calculates offsets, sets proper work amounts, decrement pointers if the same data
- * have to be read several times (broadcasting).
+ * have to be read several times (broadcasting). If the body contains reductions along the innermost dimension,
+ * every row is processed in several stages: reduction_regions hold a pair of vector and scalar Tiles per stage,
+ * they are executed before the main Tiles, so the reduced values are available to them.
  * @ingroup snippets
  */
 class TileScheduler : public ngraph::op::Op {
 public:
     OPENVINO_OP("TileScheduler", "SnippetsOpset");
 
-    TileScheduler(const AllocatedEmitter& vector_region, const AllocatedEmitter& scalar_region);
+    TileScheduler(const AllocatedEmitter& vector_region, const AllocatedEmitter& scalar_region,
+                  const std::vector<std::pair<AllocatedEmitter, AllocatedEmitter>>& reduction_regions = {});
     TileScheduler() = default;
     AllocatedEmitter vector_region;
     AllocatedEmitter scalar_region;
+    std::vector<std::pair<AllocatedEmitter, AllocatedEmitter>> reduction_regions;
     // todo: this clone_with_new_inputs is irrelevant
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
-        return std::make_shared<TileScheduler>(vector_region, scalar_region);
+        return std::make_shared<TileScheduler>(vector_region, scalar_region, reduction_regions);
     }
     const void *compile_params;
 };
@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface SoftmaxDecomposition
+ * @brief Decomposes Softmax along the innermost axis into element-wise ops and innermost-axis reductions:
+ *        max = ReduceMax(x); exp = Exp(x - max); y = exp / ReduceSum(exp)
+ * @ingroup snippets
+ */
+class SoftmaxDecomposition: public ngraph::pass::MatcherPass {
+public:
+    SoftmaxDecomposition();
+};
+
+/**
+ * @interface MVNDecomposition
+ * @brief Decomposes MVN-6 along the innermost axis into element-wise ops and innermost-axis reductions:
+ *        diff = x - ReduceSum(x) / N; y = diff / (Sqrt(ReduceSum(diff * diff) / N + eps)) (or eps outside Sqrt)
+ * @ingroup snippets
+ */
+class MVNDecomposition: public ngraph::pass::MatcherPass {
+public:
+    MVNDecomposition();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
@@ -35,6 +35,17 @@ public:
     SetScalarCountForStore();
 };
 
+/**
+ * @interface SetScalarCountForReduce
+ * @brief Set count `1` for reductions, so only the first lane of the input is accumulated
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class SetScalarCountForReduce: public ngraph::pass::MatcherPass {
+public:
+    SetScalarCountForReduce();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
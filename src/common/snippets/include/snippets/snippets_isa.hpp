@@ -16,6 +16,7 @@
 #include "op/nop.hpp"
 #include "op/scalar.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reduce.hpp"
 #include "op/store.hpp"
 #include "op/tile.hpp"
 #include "op/tile_scheduler.hpp"
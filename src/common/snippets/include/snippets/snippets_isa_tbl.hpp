@@ -19,6 +19,9 @@ NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
+NGRAPH_OP(ReduceMax, ngraph::snippets::op)
+NGRAPH_OP(ReduceSum, ngraph::snippets::op)
+
 // Layout-oblivious from opset1
 
 // opset completeness
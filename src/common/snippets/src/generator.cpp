@@ -8,6 +8,7 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/reduce.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
@@ -38,6 +39,56 @@ auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph:
     return std::make_pair(rin, rout);
 }
 
+namespace {
+// Splits ordered ops into the stages of a row: every reduction stage contains the reductions that depend on the same
+// number of preceding reductions together with their ancestors, the last stage contains the ancestors of Results.
+// Results of the preceding reductions are kept in dedicated registers, so traversal stops there and element-wise ops
+// required by several stages are recomputed by each of them.
+auto split_by_reductions(const ngraph::NodeVector& ops) -> std::vector<std::vector<bool>> {
+    std::map<const ngraph::Node*, size_t> index;
+    for (size_t i = 0; i < ops.size(); i++)
+        index[ops[i].get()] = i;
+    auto is_reduction = [](const std::shared_ptr<ngraph::Node>& n) {
+        return ov::is_type<ngraph::snippets::op::ReduceBase>(n);
+    };
+
+    std::vector<size_t> depth(ops.size(), 0);
+    size_t num_reduction_stages = 0;
+    for (size_t i = 0; i < ops.size(); i++) {
+        for (const auto& input : ops[i]->input_values()) {
+            const auto parent = index.at(input.get_node());
+            depth[i] = std::max(depth[i], depth[parent] + (is_reduction(ops[parent]) ? 1 : 0));
+        }
+        if (is_reduction(ops[i]))
+            num_reduction_stages = std::max(num_reduction_stages, depth[i] + 1);
+    }
+
+    std::vector<std::vector<bool>> stages(num_reduction_stages + 1, std::vector<bool>(ops.size(), false));
+    auto mark = [&](size_t root, std::vector<bool>& stage) {
+        std::vector<size_t> stack{root};
+        while (!stack.empty()) {
+            const auto i = stack.back();
+            stack.pop_back();
+            if (stage[i])
+                continue;
+            stage[i] = true;
+            for (const auto& input : ops[i]->input_values()) {
+                const auto parent = index.at(input.get_node());
+                if (!is_reduction(ops[parent]))
+                    stack.push_back(parent);
+            }
+        }
+    };
+    for (size_t i = 0; i < ops.size(); i++) {
+        if (is_reduction(ops[i]))
+            mark(i, stages[depth[i]]);
+        else if (ov::is_type<ngraph::op::v0::Result>(ops[i]))
+            mark(i, stages.back());
+    }
+    return stages;
+}
+} // namespace
+
 ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov::Model>& m,
                                                              const void* compile_params) const {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator::generate")
@@ -61,8 +112,9 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
 
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
+    const auto ops = m->get_ordered_ops();
     std::vector<AllocatedEmitter> lowered;
-    for (auto n : m->get_ordered_ops()) {
+    for (auto n : ops) {
         lowered.emplace_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
@@ -72,25 +124,47 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     ngraph::pass::Manager mng;
     mng.register_pass<ngraph::snippets::pass::SetScalarCountForLoad>();
     mng.register_pass<ngraph::snippets::pass::SetScalarCountForStore>();
+    mng.register_pass<ngraph::snippets::pass::SetScalarCountForReduce>();
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
+    const auto scalar_ops = m_scalar->get_ordered_ops();
     std::vector<AllocatedEmitter> scalar_lowered;
-    for (auto n : m_scalar->get_ordered_ops()) {
+    for (auto n : scalar_ops) {
         scalar_lowered.emplace_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D");
     // wrapping into tiles1D
     //todo: in, out, and io_last_dims should derive naturally from the graph representation
-    const auto& vector_tile = std::make_shared<ngraph::snippets::op::Tile>(lowered, target->get_lanes(), in, out, io_last_dims, io_data_sizes);
-    const auto& vector_region = std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(vector_tile),
-                                   std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
-    const auto& scalar_tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered, 1, in, out, io_last_dims, io_data_sizes);
-    const auto& scalar_region = std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(scalar_tile),
-                    std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
+    auto make_tile_region = [&](const std::vector<AllocatedEmitter>& region, size_t increment) {
+        const auto& tile = std::make_shared<ngraph::snippets::op::Tile>(region, increment, in, out, io_last_dims, io_data_sizes);
+        return std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(tile),
+                              std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
+    };
+    // Reductions along the innermost dimension split the row processing into several stages: each stage is a separate
+    // pair of Tiles, executed over the whole row before the next one starts
+    const auto stages = split_by_reductions(ops);
+    const auto scalar_stages = split_by_reductions(scalar_ops);
+    auto stage_region = [](const std::vector<AllocatedEmitter>& region, const std::vector<bool>& stage) {
+        std::vector<AllocatedEmitter> result;
+        for (size_t i = 0; i < region.size(); i++) {
+            if (stage[i])
+                result.push_back(region[i]);
+        }
+        return result;
+    };
+    std::vector<std::pair<AllocatedEmitter, AllocatedEmitter>> reduction_regions;
+    for (size_t i = 0; i + 1 < stages.size(); i++) {
+        reduction_regions.emplace_back(make_tile_region(stage_region(lowered, stages[i]), target->get_lanes()),
+                                       make_tile_region(stage_region(scalar_lowered, scalar_stages[i]), 1));
+    }
+    const auto& vector_region = stages.size() == 1 ? make_tile_region(lowered, target->get_lanes()) :
+                                make_tile_region(stage_region(lowered, stages.back()), target->get_lanes());
+    const auto& scalar_region = stages.size() == 1 ? make_tile_region(scalar_lowered, 1) :
+                                make_tile_region(stage_region(scalar_lowered, scalar_stages.back()), 1);
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
-    auto tile_scheduler = std::make_shared<ngraph::snippets::op::TileScheduler>(vector_region, scalar_region);
+    auto tile_scheduler = std::make_shared<ngraph::snippets::op::TileScheduler>(vector_region, scalar_region, reduction_regions);
     tile_scheduler->compile_params = compile_params;
     const auto& tile_scheduler_region = std::make_pair(target->get(ngraph::snippets::op::TileScheduler::get_type_info_static())(tile_scheduler),
                                                        std::make_pair(std::vector<size_t>({in, out, target->get_lanes()}), std::vector<size_t>{}));
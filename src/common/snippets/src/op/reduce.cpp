@@ -0,0 +1,45 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/reduce.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::ReduceBase::ReduceBase(const Output<Node>& x, const size_t count) : Op({x}), m_count(count) {
+}
+
+bool snippets::op::ReduceBase::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+void snippets::op::ReduceBase::validate_and_infer_types() {
+    auto output_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, output_shape.rank().is_static() && output_shape.rank().get_length() > 0,
+                          "Reduction expects an input of static non-zero rank");
+    output_shape[output_shape.rank().get_length() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+snippets::op::ReduceMax::ReduceMax(const Output<Node>& x, const size_t count) : ReduceBase(x, count) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::ReduceMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceMax);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceMax>(new_args.at(0), m_count);
+}
+
+snippets::op::ReduceSum::ReduceSum(const Output<Node>& x, const size_t count) : ReduceBase(x, count) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> snippets::op::ReduceSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceSum);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceSum>(new_args.at(0), m_count);
+}
@@ -7,6 +7,7 @@
 
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/reduce.hpp"
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/load_movebroadcast_to_broadcastload.hpp"
@@ -17,11 +18,13 @@
 #include "snippets/pass/transform_convert_to_truncation.hpp"
 #include "snippets/pass/insert_convert_on_inputs.hpp"
 #include "snippets/pass/reset_type_relaxed_node_precision.hpp"
+#include "snippets/pass/reduction_decomposition.hpp"
 
 #include "transformations/common_optimizations/nop_elimination.hpp"
 #include "transformations/utils/utils.hpp"
 
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include "ngraph/pass/constant_folding.hpp"
 #include <openvino/pass/serialize.hpp>
 
@@ -201,13 +204,22 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = m_body->get_parameters()[i]->get_shape();
+        // the body may have been created for dynamic shapes, so the parameter is replaced with the static one
+        const auto& paramShape = m_body->get_parameters()[i]->get_partial_shape();
         const auto paramType =  m_body->get_parameters()[i]->get_element_type();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()) || paramType != inType)
+        if (paramShape.is_dynamic() || paramShape.to_shape() != inShape || paramType != inType)
                 m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(inType, inShape));
     }
 
     m_body->validate_nodes_and_infer_types();
+    // Softmax and MVN are decomposed while the shapes are static, but before the element types are aligned,
+    // since the alignment converts MVN axes to the execution type
+    if (has_domain_sensitive_ops()) {
+        ngraph::pass::Manager manager;
+        manager.register_pass<snippets::pass::SoftmaxDecomposition>();
+        manager.register_pass<snippets::pass::MVNDecomposition>();
+        manager.run_passes(m_body);
+    }
     auto skipStartEndOnes = [](const Shape& shape) {
         auto begin = shape.begin();
         auto end = shape.end();
@@ -249,6 +261,14 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
     return exec_domain;
 }
 
+bool snippets::op::Subgraph::has_domain_sensitive_ops() const {
+    const auto& ops = m_body->get_ops();
+    return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
+        return ov::is_type<ov::op::v1::Softmax>(op) || ov::is_type<ov::op::v8::Softmax>(op) ||
+               ov::is_type<ov::op::v6::MVN>(op) || ov::is_type<snippets::op::ReduceBase>(op);
+    });
+}
+
 void snippets::op::Subgraph::align_element_types(const BlockedShapeVector& outputShapes,
                                                  const BlockedShapeVector& inputShapes) {
     // TODO: At the moment snippets support execution in only one element type
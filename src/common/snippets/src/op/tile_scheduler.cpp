@@ -5,6 +5,7 @@
 #include "snippets/op/tile_scheduler.hpp"
 #include "snippets/generator.hpp"
 
-ngraph::snippets::op::TileScheduler::TileScheduler(const AllocatedEmitter& vector_region, const AllocatedEmitter& scalar_region)
-    : Op(), vector_region{vector_region}, scalar_region{scalar_region} {
+ngraph::snippets::op::TileScheduler::TileScheduler(const AllocatedEmitter& vector_region, const AllocatedEmitter& scalar_region,
+                                                   const std::vector<std::pair<AllocatedEmitter, AllocatedEmitter>>& reduction_regions)
+    : Op(), vector_region{vector_region}, scalar_region{scalar_region}, reduction_regions{reduction_regions} {
 }
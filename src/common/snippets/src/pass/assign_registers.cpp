@@ -113,7 +113,22 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
     std::stack<Reg> bank;
     for (int i = 0; i < 16; i++) bank.push(16-1-i);
 
+    // Reduction outputs are accumulators: they are updated on every Tile iteration and read by the following
+    // Tiles of the same row, so they have to keep a dedicated register for the whole kernel
+    std::set<int> accumulators;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        if (ov::is_type<snippets::op::ReduceBase>(stmts[i])) {
+            if (bank.empty())
+                throw ngraph_error("cannot allocate accumulator registers for a snippet ");
+            register_map[i] = bank.top();
+            bank.pop();
+            accumulators.insert(static_cast<int>(i));
+        }
+    }
+
     for (auto interval : live_intervals) {
+        if (accumulators.count(interval.first))
+            continue;
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
@@ -124,7 +139,7 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             bank.push(register_map[x.first]);
         }
         // allocate
-        if (active.size() == 16) {
+        if (active.size() + accumulators.size() == 16) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
             register_map[interval.first] = bank.top();
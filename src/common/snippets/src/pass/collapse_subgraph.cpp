@@ -10,6 +10,8 @@
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset5.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/op/loop.hpp>
 #include "transformations/utils/utils.hpp"
@@ -32,6 +34,13 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // dynamic outputs can be scheduled together only if their shapes are guaranteed to be equal
+    if (std::any_of(outputs.begin(), outputs.end(), [](const Output<const Node>& out) { return out.get_partial_shape().is_dynamic(); })) {
+        const auto& ref_shape = outputs.begin()->get_partial_shape();
+        return std::any_of(outputs.begin(), outputs.end(), [&ref_shape](const Output<const Node>& out) {
+            return out.get_partial_shape() != ref_shape;
+        });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -105,11 +114,39 @@ auto is_layout_oblivious(const std::shared_ptr<const Node> &n) -> bool {
     return is_layout_oblivious_unary(n) || is_layout_oblivious_binary(n);
 }
 
+// Softmax and MVN are supported only along the innermost dimension: they are decomposed into element-wise ops and
+// reductions, which are executed row by row inside the kernel
+auto is_supported_reduction(const std::shared_ptr<const Node> &n) -> bool {
+    if (!(ov::is_type<ngraph::opset1::Softmax>(n) || ov::is_type<ngraph::opset8::Softmax>(n) || ov::is_type<ngraph::opset6::MVN>(n)))
+        return false;
+    const auto& shape = n->get_input_partial_shape(0);
+    if (n->get_input_element_type(0) != ngraph::element::f32 || shape.rank().is_dynamic() || shape.rank().get_length() == 0)
+        return false;
+    const auto rank = shape.rank().get_length();
+    // the reduction domain can't be broadcasted, so it must be known and non-trivial
+    if (shape[rank - 1].is_dynamic() || shape[rank - 1].get_length() == 1)
+        return false;
+    int64_t axis = 0;
+    if (const auto softmax_v8 = ov::as_type_ptr<const ngraph::opset8::Softmax>(n)) {
+        axis = softmax_v8->get_axis();
+    } else if (const auto softmax_v1 = ov::as_type_ptr<const ngraph::opset1::Softmax>(n)) {
+        axis = static_cast<int64_t>(softmax_v1->get_axis());
+    } else {
+        const auto axes = ov::as_type_ptr<const ngraph::opset1::Constant>(n->get_input_node_shared_ptr(1));
+        if (!axes || ngraph::shape_size(axes->get_shape()) != 1)
+            return false;
+        axis = axes->cast_vector<int64_t>()[0];
+    }
+    if (axis < 0)
+        axis += rank;
+    return axis == rank - 1;
+}
+
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
         static const std::set<ngraph::element::Type> supported_data_types =
                 { ngraph::element::f32, ngraph::element::i32, ngraph::element::bf16, ngraph::element::i8, ngraph::element::u8 };
-        return t.get_partial_shape().is_static() && supported_data_types.count(t.get_element_type()) != 0;
+        return t.get_partial_shape().rank().is_static() && supported_data_types.count(t.get_element_type()) != 0;
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -121,7 +158,9 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // MVN axes are consumed by the decomposition, so only the data input is checked
+    const auto inputs_end = ov::is_type<ngraph::opset6::MVN>(n) ? inputs.begin() + 1 : inputs.end();
+    return std::all_of(inputs.begin(), inputs_end, [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -162,7 +201,7 @@ auto update_out_tensor_name(std::shared_ptr<ngraph::snippets::op::Subgraph> &sub
 } // namespace
 
 bool AppropriateForSubgraph(const std::shared_ptr<const Node> &node) {
-    return is_layout_oblivious(node) && has_supported_in_out(node);
+    return (is_layout_oblivious(node) || is_supported_reduction(node)) && has_supported_in_out(node);
 }
 
 void SetSnippetsNodeType(const std::shared_ptr<Node> &node, SnippetsNodeType nodeType) {
@@ -0,0 +1,111 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/pass/reduction_decomposition.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+namespace {
+auto make_scalar(const ov::element::Type& type, float value) -> std::shared_ptr<ngraph::Node> {
+    return ngraph::opset1::Constant::create(type, ngraph::Shape{}, {value});
+}
+} // namespace
+
+ngraph::snippets::pass::SoftmaxDecomposition::SoftmaxDecomposition() {
+    MATCHER_SCOPE(SoftmaxDecomposition);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>(), matcher_name),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SoftmaxDecomposition")
+            auto root = m.get_match_root();
+            const auto rank = root->get_input_partial_shape(0).rank();
+            if (rank.is_dynamic())
+                return false;
+
+            int64_t axis = 0;
+            if (const auto softmax_v8 = ngraph::as_type_ptr<ngraph::opset8::Softmax>(root)) {
+                axis = softmax_v8->get_axis();
+                if (axis < 0)
+                    axis += rank.get_length();
+            } else if (const auto softmax_v1 = ngraph::as_type_ptr<ngraph::opset1::Softmax>(root)) {
+                axis = static_cast<int64_t>(softmax_v1->get_axis());
+            } else {
+                return false;
+            }
+            if (axis != rank.get_length() - 1)
+                return false;
+
+            const auto data = root->input_value(0);
+            const auto max = std::make_shared<ngraph::snippets::op::ReduceMax>(data);
+            const auto sub = std::make_shared<ngraph::opset1::Subtract>(data, max);
+            const auto exp = std::make_shared<ngraph::opset1::Exp>(sub);
+            const auto sum = std::make_shared<ngraph::snippets::op::ReduceSum>(exp);
+            const auto div = std::make_shared<ngraph::opset1::Divide>(exp, sum);
+
+            ngraph::copy_runtime_info(root, {max, sub, exp, sum, div});
+            div->set_friendly_name(root->get_friendly_name());
+            ngraph::replace_node(root, div);
+            return true;
+        });
+}
+
+ngraph::snippets::pass::MVNDecomposition::MVNDecomposition() {
+    MATCHER_SCOPE(MVNDecomposition);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::opset6::MVN>(), matcher_name),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::MVNDecomposition")
+            const auto mvn = ngraph::as_type_ptr<ngraph::opset6::MVN>(m.get_match_root());
+            if (!mvn)
+                return false;
+            const auto& shape = mvn->get_input_partial_shape(0);
+            const auto axes = ngraph::as_type_ptr<ngraph::opset1::Constant>(mvn->get_input_node_shared_ptr(1));
+            if (shape.rank().is_dynamic() || !axes || ngraph::shape_size(axes->get_shape()) != 1)
+                return false;
+            const auto rank = shape.rank().get_length();
+            auto axis = axes->cast_vector<int64_t>()[0];
+            if (axis < 0)
+                axis += rank;
+            if (axis != rank - 1 || shape[rank - 1].is_dynamic())
+                return false;
+
+            const auto data = mvn->input_value(0);
+            const auto type = data.get_element_type();
+            const auto inv_n = make_scalar(type, 1.f / static_cast<float>(shape[rank - 1].get_length()));
+            NodeVector decomposition;
+
+            const auto sum = std::make_shared<ngraph::snippets::op::ReduceSum>(data);
+            const auto mean = std::make_shared<ngraph::opset1::Multiply>(sum, inv_n);
+            const auto diff = std::make_shared<ngraph::opset1::Subtract>(data, mean);
+            decomposition.insert(decomposition.end(), {inv_n, sum, mean, diff});
+            std::shared_ptr<ngraph::Node> result = diff;
+            if (mvn->get_normalize_variance()) {
+                const auto eps = make_scalar(type, mvn->get_eps());
+                const auto sqr = std::make_shared<ngraph::opset1::Multiply>(diff, diff);
+                const auto sqr_sum = std::make_shared<ngraph::snippets::op::ReduceSum>(sqr);
+                const auto variance = std::make_shared<ngraph::opset1::Multiply>(sqr_sum, inv_n);
+                std::shared_ptr<ngraph::Node> denominator;
+                if (mvn->get_eps_mode() == ngraph::op::MVNEpsMode::INSIDE_SQRT) {
+                    denominator = std::make_shared<ngraph::opset1::Sqrt>(std::make_shared<ngraph::opset1::Add>(variance, eps));
+                } else {
+                    denominator = std::make_shared<ngraph::opset1::Add>(std::make_shared<ngraph::opset1::Sqrt>(variance), eps);
+                }
+                result = std::make_shared<ngraph::opset1::Divide>(diff, denominator);
+                decomposition.insert(decomposition.end(), {eps, sqr, sqr_sum, variance, denominator->get_input_node_shared_ptr(0),
+                                                           denominator, result});
+            }
+
+            ngraph::copy_runtime_info(mvn, decomposition);
+            result->set_friendly_name(mvn->get_friendly_name());
+            ngraph::replace_node(mvn, result);
+            return true;
+        });
+}
@@ -47,3 +47,22 @@ ngraph::snippets::pass::SetScalarCountForStore::SetScalarCountForStore() {
             return true;
         });
 }
+
+ngraph::snippets::pass::SetScalarCountForReduce::SetScalarCountForReduce() {
+    MATCHER_SCOPE(SetScalarCountForReduce);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::snippets::op::ReduceBase>(), matcher_name),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SetScalarCountForReduce_callback")
+            auto root = m.get_match_root();
+            if (transformation_callback(root))
+                return false;
+
+            const auto reduce = ov::as_type_ptr<ngraph::snippets::op::ReduceBase>(root);
+            if (!reduce)
+                return false;
+
+            reduce->set_count(1lu);
+            return true;
+        });
+}
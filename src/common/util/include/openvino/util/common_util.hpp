@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <cstring>
 #include <sstream>
 #include <string>
@@ -112,6 +113,41 @@ T ceil_div(const T& x, const T& y) {
     return (x == 0 ? 0 : (1 + (x - 1) / y));
 }
 
+/**
+ * @brief Computes 64-bit non-cryptographic hash of the data (XXH64 algorithm)
+ * @param data - pointer to the data
+ * @param size - size of the data in bytes
+ * @param seed - initial hash value
+ * @return hash value
+ */
+uint64_t hash_data(const void* data, size_t size, uint64_t seed = 0);
+
+/**
+ * @brief Size of the chunks hashed independently by hash_data_chunked
+ */
+constexpr size_t hash_data_chunk_size = 1 << 20;
+
+/**
+ * @brief Computes 64-bit hash of the data split into fixed size chunks, which are hashed independently
+ * and thus can be processed in parallel. The result depends on the data only, not on the number of threads.
+ * @param data - pointer to the data
+ * @param size - size of the data in bytes
+ * @param parallel_for - callable with the (size_t work_amount, std::function<void(size_t)> body) signature
+ * @return hash value
+ */
+template <typename ParallelFor>
+uint64_t hash_data_chunked(const void* data, size_t size, ParallelFor&& parallel_for) {
+    if (size <= hash_data_chunk_size)
+        return hash_data(data, size);
+    const auto bytes = static_cast<const uint8_t*>(data);
+    std::vector<uint64_t> hashes(ceil_div(size, hash_data_chunk_size));
+    parallel_for(hashes.size(), [&](size_t i) {
+        const size_t offset = i * hash_data_chunk_size;
+        hashes[i] = hash_data(bytes + offset, std::min(hash_data_chunk_size, size - offset), i);
+    });
+    return hash_data(hashes.data(), hashes.size() * sizeof(uint64_t), size);
+}
+
 template <typename T, typename A, typename V>
 bool contains(const std::vector<T, A>& vec, const V& v) {
     return std::any_of(vec.begin(), vec.end(), [&](const T& x) {
@@ -348,16 +348,11 @@ private:
     ov::op::util::VariableVector m_variables;
     RTMap m_rt_info;
 
-    // Cache of topologically sorted nodes which is stored as a vector
-    // of weak_ptr not to increase node ref counter to prevent the situation when
-    // node has no consumers but still exists in a graph.
-    mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
-
     mutable std::unordered_map<std::string, Output<Node>> m_cached_output_names;
     mutable std::unordered_map<std::string, std::weak_ptr<Node>> m_cached_op_names;
 
     // Private runtime info which is shared across nodes and used only
-    // for internal purposes.
+    // for internal purposes. It also keeps the cache of topologically sorted nodes.
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
 
     mutable std::mutex m_topological_sort_mutex;
@@ -14,11 +14,18 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *        In the parallel mode Convert, Multiply, Subtract and Transpose of large constants are folded
+ *        by kernels which split the data between threads.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+
+    /// \param parallel  Fold the nodes which depend only on constants in waves, the nodes of one wave
+    ///                  are evaluated on several threads.
+    explicit ConstantFolding(bool parallel = false) : m_parallel(parallel) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +33,14 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the nodes with constant inputs wave by wave, starting from the nodes which consume
+    /// only the model constants. The nodes of one wave are independent and are evaluated concurrently.
+    bool parallel_folding(const std::shared_ptr<ov::Model>& model, bool revalidate);
+    /// \brief Replaces the node outputs with the folded values.
+    bool replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+private:
+    bool m_parallel = false;
 };
 
 /**
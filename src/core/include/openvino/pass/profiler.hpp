@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace pass {
+/// \brief Statistics of a single pass run by pass::Manager
+/// \ingroup ov_pass_cpp_api
+struct PassProfileRecord {
+    /// \brief Name of the pass
+    std::string name;
+    /// \brief Name of the model the pass was run on
+    std::string model;
+    /// \brief Nesting level, the passes run by a Manager inside of another pass have non-zero depth
+    size_t depth = 0;
+    /// \brief Index of the thread which run the pass, in order of the first appearance
+    size_t thread = 0;
+    /// \brief Start time in microseconds since the profiler creation
+    int64_t start_us = 0;
+    /// \brief Wall time of the pass in microseconds including the nested passes
+    int64_t duration_us = 0;
+    /// \brief Number of the model operations before and after the pass
+    size_t nodes_before = 0;
+    size_t nodes_after = 0;
+    /// \brief Number of the successful matcher callbacks, zero for the passes which are not based on matchers
+    size_t matcher_hits = 0;
+    /// \brief Value returned by the pass
+    bool changed = false;
+};
+
+/// \brief Collects PassProfileRecord for every pass run by pass::Manager on the threads where the profiler
+/// is activated by PassProfiler::Scope. Unlike the OV_PROFILE_PASS_ENABLE output it covers the nested Managers
+/// and can be retrieved by the caller, for example to attach it to the compiled model.
+///
+///     auto profiler = std::make_shared<pass::PassProfiler>();
+///     {
+///         pass::PassProfiler::Scope scope(profiler);
+///         manager.run_passes(f);
+///     }
+///     profiler->dump_chrome_trace(std::ofstream("passes.json"));
+///
+/// \ingroup ov_pass_cpp_api
+class OPENVINO_API PassProfiler {
+public:
+    /// \brief Activates the profiler on the current thread while the scope is alive.
+    /// Scope with nullptr profiler does nothing, so the profiling may be enabled conditionally.
+    class OPENVINO_API Scope {
+    public:
+        explicit Scope(const std::shared_ptr<PassProfiler>& profiler);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        PassProfiler* m_previous;
+        std::vector<size_t> m_previous_open_records;
+        bool m_active;
+    };
+
+    PassProfiler();
+
+    /// \brief Returns the profiler active on the current thread or nullptr
+    static PassProfiler* get_active();
+
+    /// \brief Returns a copy of the collected records in order of the pass start
+    std::vector<PassProfileRecord> get_records() const;
+
+    /// \brief Writes the records as JSON in the Chrome trace event format, which can be opened
+    /// by chrome://tracing or Perfetto. Statistics of a pass are stored in the event arguments.
+    void dump_chrome_trace(std::ostream& stream) const;
+
+    /// \brief Writes the passes aggregated by name and sorted by the total time
+    void dump_summary(std::ostream& stream) const;
+
+    /// \brief Interface for pass::Manager and GraphRewrite
+    size_t begin_pass(const std::string& name, const std::string& model, size_t nodes_before);
+    void end_pass(size_t record, size_t nodes_after, bool changed);
+    void add_matcher_hit();
+
+private:
+    int64_t now_us() const;
+    size_t get_thread_index();
+
+    const int64_t m_start_us;
+    std::vector<PassProfileRecord> m_records;
+    std::vector<std::thread::id> m_threads;
+    mutable std::mutex m_mutex;
+};
+}  // namespace pass
+}  // namespace ov
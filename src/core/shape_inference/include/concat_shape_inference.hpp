@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <algorithm>
+#include <openvino/op/concat.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+template <class T>
+void shape_infer(const Concat* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty() && output_shapes.size() == 1);
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+
+    auto& output_shape = output_shapes[0];
+    DimType concat_dim{0};
+    int64_t concat_axis = -1;
+
+    for (size_t i = 0; i < input_shapes.size(); ++i) {
+        const auto& input_shape = input_shapes[i];
+        const auto input_rank = input_shape.rank();
+        if (input_rank.is_dynamic())
+            continue;
+        const auto rank = input_rank.get_length();
+        // the axis is normalized locally, the op itself is left untouched
+        const auto axis = op->get_axis() < 0 ? op->get_axis() + rank : op->get_axis();
+        NODE_VALIDATION_CHECK(op,
+                              axis < rank && axis >= 0,
+                              "Concatenation axis (",
+                              axis,
+                              ") is out of bounds [",
+                              -rank,
+                              ", ",
+                              rank - 1,
+                              "] for ",
+                              "argument ",
+                              i,
+                              ", which has shape ",
+                              input_shape,
+                              ".");
+        concat_dim += input_shape[axis];
+
+        if (concat_axis < 0) {
+            concat_axis = axis;
+            output_shape = input_shape;
+            continue;
+        }
+        bool compatible = rank == static_cast<int64_t>(output_shape.size());
+        for (int64_t d = 0; compatible && d < rank; ++d) {
+            if (d != axis)
+                compatible = DimType::merge(output_shape[d], output_shape[d], input_shape[d]);
+        }
+        NODE_VALIDATION_CHECK(op,
+                              compatible,
+                              "Argument shapes are inconsistent; they must have the same rank, and must "
+                              "have ",
+                              "equal dimension everywhere except on the concatenation axis (axis ",
+                              axis,
+                              ").");
+    }
+
+    if (concat_axis >= 0) {
+        // an input of dynamic rank makes the concatenated dimension unknown
+        const bool all_ranks_static = std::all_of(input_shapes.begin(), input_shapes.end(), [](const T& shape) {
+            return shape.rank().is_static();
+        });
+        output_shape[concat_axis] = all_ranks_static ? concat_dim : DimType();
+    } else {
+        output_shape = ov::PartialShape::dynamic();
+    }
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
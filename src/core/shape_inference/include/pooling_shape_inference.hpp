@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <ngraph/util.hpp>
+#include <openvino/op/avg_pool.hpp>
+#include <openvino/op/max_pool.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace pooling {
+
+/**
+ * @brief Infers the output shape of the pooling over the spatial dimensions of the input.
+ * The effective pads are written to pads_begin/pads_end, the op attributes are not modified.
+ */
+template <class OpType, class T>
+void shape_infer(const OpType* op,
+                 const T& data_shape,
+                 T& output_shape,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end,
+                 const Strides& dilations,
+                 bool is_window_all_in_padding_allowed) {
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    const auto& kernel = op->get_kernel();
+    const auto& strides = op->get_strides();
+    const auto auto_pad = op->get_auto_pad();
+
+    NODE_VALIDATION_CHECK(
+        op,
+        data_shape.rank().compatible(3) || data_shape.rank().compatible(4) || data_shape.rank().compatible(5),
+        "Expected a 3D, 4D or 5D tensor for the input. Got: ",
+        data_shape);
+
+    if (data_shape.rank().is_dynamic()) {
+        output_shape = ov::PartialShape::dynamic();
+        return;
+    }
+
+    const auto num_spatial = data_shape.size() - 2;
+    NODE_VALIDATION_CHECK(op,
+                          kernel.size() == num_spatial,
+                          "Expected kernel size to be equal to input size - 2. Got: ",
+                          kernel.size());
+    NODE_VALIDATION_CHECK(op,
+                          strides.size() == num_spatial,
+                          "Expected strides size to be equal to input size - 2. Got: ",
+                          strides.size());
+
+    pads_begin.assign(num_spatial, 0);
+    pads_end.assign(num_spatial, 0);
+    if (auto_pad == PadType::EXPLICIT || auto_pad == PadType::NOTSET) {
+        const auto& op_pads_begin = op->get_pads_begin();
+        const auto& op_pads_end = op->get_pads_end();
+        NODE_VALIDATION_CHECK(op,
+                              op_pads_begin.size() == num_spatial,
+                              "Expected pads_begin size to be equal to input size - 2. Got: ",
+                              op_pads_begin.size());
+        NODE_VALIDATION_CHECK(op,
+                              op_pads_end.size() == num_spatial,
+                              "Expected pads_end size to be equal to input size - 2. Got: ",
+                              op_pads_end.size());
+        std::copy(op_pads_begin.begin(), op_pads_begin.end(), pads_begin.begin());
+        std::copy(op_pads_end.begin(), op_pads_end.end(), pads_end.begin());
+    }
+
+    output_shape.resize(data_shape.size());
+    output_shape[0] = data_shape[0];
+    output_shape[1] = data_shape[1];
+    for (size_t i = 0; i < num_spatial; ++i) {
+        const auto& data_dim = data_shape[i + 2];
+        const auto dilation = dilations.empty() ? 1 : static_cast<int64_t>(dilations[i]);
+        const auto stride = static_cast<int64_t>(strides[i]);
+        const auto window = (static_cast<int64_t>(kernel[i]) - 1) * dilation + 1;
+
+        NODE_VALIDATION_CHECK(op, stride > 0, "Window strides must be positive. Got: ", strides, ".");
+        NODE_VALIDATION_CHECK(op,
+                              window > 0,
+                              "Window after dilation has dimension less than 1 (dim: ",
+                              window,
+                              ") at axis ",
+                              i,
+                              ".");
+
+        if (data_dim.is_dynamic()) {
+            output_shape[i + 2] = DimType();
+            continue;
+        }
+        const auto data_size = static_cast<int64_t>(data_dim.get_length());
+
+        if (auto_pad == PadType::SAME_UPPER || auto_pad == PadType::SAME_LOWER) {
+            const auto same_out = (data_size + stride - 1) / stride;
+            const auto needed = std::max(int64_t(0), (same_out - 1) * stride + window - data_size);
+            const auto lhs = needed / 2;
+            pads_begin[i] = auto_pad == PadType::SAME_UPPER ? lhs : needed - lhs;
+            pads_end[i] = auto_pad == PadType::SAME_UPPER ? needed - lhs : lhs;
+        }
+
+        NODE_VALIDATION_CHECK(op,
+                              is_window_all_in_padding_allowed || (window > pads_begin[i] && window > pads_end[i]),
+                              "Window after dilation is sometimes entirely in the padding area for axis ",
+                              i,
+                              " (dilated window dimension: ",
+                              window,
+                              ", padding below dimension: ",
+                              pads_begin[i],
+                              ", padding above dimension: ",
+                              pads_end[i],
+                              ") and this is not ",
+                              "allowed.");
+
+        const auto padded = data_size + pads_begin[i] + pads_end[i];
+        NODE_VALIDATION_CHECK(op,
+                              window <= padded,
+                              "Window after dilation has dimension (dim: ",
+                              window,
+                              ") larger than the data shape after padding (dim: ",
+                              padded,
+                              ") at axis ",
+                              i,
+                              ".");
+
+        const auto range = static_cast<size_t>(padded - window);
+        output_shape[i + 2] = (op->get_rounding_type() == RoundingType::CEIL ? ngraph::ceil_div(range, strides[i])
+                                                                              : range / strides[i]) + 1;
+    }
+}
+
+}  // namespace pooling
+
+namespace v1 {
+
+template <class T>
+void shape_infer(const MaxPool* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    pooling::shape_infer(op, input_shapes[0], output_shapes[0], pads_begin, pads_end, Strides{}, true);
+}
+
+template <class T>
+void shape_infer(const AvgPool* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    pooling::shape_infer(op, input_shapes[0], output_shapes[0], pads_begin, pads_end, Strides{}, !op->get_exclude_pad());
+}
+
+}  // namespace v1
+
+namespace v8 {
+
+template <class T>
+void shape_infer(const MaxPool* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 CoordinateDiff& pads_begin,
+                 CoordinateDiff& pads_end) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 2);
+    pooling::shape_infer(op, input_shapes[0], output_shapes[0], pads_begin, pads_end, op->get_dilations(), true);
+    // indices have the same shape as values
+    output_shapes[1] = output_shapes[0];
+}
+
+}  // namespace v8
+}  // namespace op
+}  // namespace ov
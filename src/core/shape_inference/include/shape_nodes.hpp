@@ -139,7 +139,7 @@ void shape_infer(const ov::opset1::Unsqueeze* op,
     std::set<int64_t> unique_sorted_axes(axes.begin(), axes.end());
     for (const auto& axis : unique_sorted_axes) {
         NODE_VALIDATION_CHECK(op, axis <= expanded_rank, "provided 'axes' value ", axis, " is not valid.");
-        output_shape.insert(next(output_shape.begin(), axis), 1);
+        output_shape.insert(std::next(output_shape.begin(), axis), 1);
     }
 }
 
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <openvino/op/transpose.hpp>
+#include <openvino/util/common_util.hpp>
+
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v1 {
+
+template <class T>
+void shape_infer(const Transpose* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data = {}) {
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& arg_shape = input_shapes[0];
+    const auto& order_shape = input_shapes[1];
+    auto& output_shape = output_shapes[0];
+
+    NODE_VALIDATION_CHECK(op, order_shape.rank().compatible(1), "Input order must be a vector.");
+
+    std::vector<int64_t> order;
+    if (arg_shape.rank().is_static() && get_data_as_int64<T>(1, op, order, constant_data)) {
+        const auto rank = arg_shape.rank().get_length();
+        // the empty order reverses the dimensions
+        if (order.empty()) {
+            for (int64_t i = rank - 1; i >= 0; --i)
+                order.push_back(i);
+        }
+        std::vector<bool> used(rank, false);
+        bool valid = static_cast<int64_t>(order.size()) == rank;
+        for (size_t i = 0; valid && i < order.size(); ++i) {
+            valid = order[i] >= 0 && order[i] < rank && !used[order[i]];
+            if (valid)
+                used[order[i]] = true;
+        }
+        NODE_VALIDATION_CHECK(op,
+                              valid,
+                              "Permutation ",
+                              ov::util::vector_to_string(order),
+                              " is not valid for input shape ",
+                              arg_shape);
+
+        output_shape.resize(rank);
+        for (int64_t i = 0; i < rank; ++i)
+            output_shape[i] = arg_shape[order[i]];
+    } else {
+        output_shape = ov::PartialShape::dynamic(arg_shape.rank());
+    }
+}
+
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
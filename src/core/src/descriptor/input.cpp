@@ -32,7 +32,9 @@ ov::descriptor::Input::~Input() {
 }
 
 void ov::descriptor::Input::replace_output(Output& new_output) {
+    Node* old_producer = nullptr;
     if (m_output != nullptr) {
+        old_producer = m_output->get_node().get();
         m_output->remove_input(this);
     }
     new_output.add_input(this);
@@ -40,11 +42,11 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     m_src_node = std::shared_ptr<ngraph::Node>(new_output.get_node());
 
     // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
+    // so the change is recorded into shared node info to update the cache.
     for_each(m_node->m_shared_rt_info.cbegin(),
              m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
+             [&](const std::shared_ptr<SharedRTInfo>& info) {
+                 info->record_edge_change(m_node, old_producer);
              });
 }
 
@@ -5,8 +5,10 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <stack>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "layout_utils.hpp"
@@ -86,6 +88,140 @@ ngraph::ParameterVector auto_detect_parameters(const std::vector<std::shared_ptr
     return parameter_vector;
 }
 
+/// \brief Updates the cached topological order after the recorded edge changes instead of sorting the whole
+/// graph. The nodes which aren't cached yet are inserted right before the first changed consumer in the same
+/// depth-first order as topological_sort does, the nodes which aren't reachable from the roots anymore are erased.
+/// The cost depends on the number of the changes and of the new nodes, not on the size of the graph.
+/// \return false if the change doesn't fit the cached order, the full sort is required in this case.
+bool update_ordered_ops(ov::OrderedOpsCache& cache,
+                        const std::vector<ov::Node*>& changed_consumers,
+                        const std::vector<ov::Node*>& released_producers,
+                        const std::vector<ov::Node*>& destroyed_nodes,
+                        const std::unordered_set<ov::Node*>& roots,
+                        ov::NodeVector& new_ops) {
+    OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::update_ordered_ops");
+    // the destroyed nodes are erased first, their addresses may be reused by the new nodes
+    for (auto node : destroyed_nodes) {
+        cache.erase(node);
+    }
+
+    // the local update isn't cheaper than the full sort if the most of the graph has changed
+    if ((changed_consumers.size() + released_producers.size()) * 4 > cache.size())
+        return false;
+
+    using Iterator = ov::OrderedOpsCache::Iterator;
+    std::vector<Iterator> consumers;
+    for (auto consumer : changed_consumers) {
+        auto it = cache.find(consumer);
+        if (it != cache.end())
+            consumers.push_back(it);
+    }
+    std::sort(consumers.begin(), consumers.end(), [](const Iterator& lhs, const Iterator& rhs) {
+        return lhs->label < rhs->label;
+    });
+    consumers.erase(std::unique(consumers.begin(), consumers.end()), consumers.end());
+
+    // The new nodes, every group is inserted before the consumer at the same index of consumers
+    std::unordered_set<ov::Node*> new_nodes;
+    std::vector<ov::NodeVector> groups(consumers.size());
+    for (size_t g = 0; g < consumers.size(); g++) {
+        const auto label = consumers[g]->label;
+        const auto consumer_ptr = consumers[g]->node.lock();
+        if (!consumer_ptr)
+            continue;
+        ov::Node* consumer = consumer_ptr.get();
+        bool ordered = true;
+        // the cached dependencies must precede the consumer, the new ones are emitted by the traversal
+        auto is_done = [&](ov::Node* dep) {
+            auto it = cache.find(dep);
+            if (it != cache.end()) {
+                ordered &= it->label < label;
+                return true;
+            }
+            return new_nodes.count(dep) != 0;
+        };
+
+        std::stack<ov::Node*, std::vector<ov::Node*>> nodes_to_do;
+        nodes_to_do.push(consumer);
+        while (!nodes_to_do.empty()) {
+            ov::Node* node = nodes_to_do.top();
+            if (new_nodes.count(node) != 0) {
+                nodes_to_do.pop();
+                continue;
+            }
+            bool can_add = true;
+            const size_t arg_count = node->get_input_size();
+            for (size_t i = 0; i < arg_count; ++i) {
+                ov::Node* dep = node->get_input_node_ptr(arg_count - i - 1);
+                if (!is_done(dep)) {
+                    can_add = false;
+                    nodes_to_do.push(dep);
+                }
+            }
+            for (const auto& depptr : node->get_control_dependencies()) {
+                if (!is_done(depptr.get())) {
+                    can_add = false;
+                    nodes_to_do.push(depptr.get());
+                }
+            }
+            if (!ordered)
+                return false;
+            if (can_add) {
+                nodes_to_do.pop();
+                // the consumer itself is already cached
+                if (node != consumer) {
+                    groups[g].push_back(node->shared_from_this());
+                    new_nodes.insert(node);
+                }
+            }
+        }
+    }
+
+    // The producers which have lost a consumer are removed if no consumer in the graph is left
+    std::unordered_set<ov::Node*> removed;
+    auto in_graph = [&](ov::Node* node) {
+        return (cache.contains(node) || new_nodes.count(node) != 0) && removed.count(node) == 0;
+    };
+    std::vector<ov::Node*> candidates(released_producers);
+    while (!candidates.empty()) {
+        ov::Node* node = candidates.back();
+        candidates.pop_back();
+        if (!in_graph(node) || roots.count(node) != 0)
+            continue;
+        bool used = false;
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                used |= in_graph(input.get_node());
+            }
+        }
+        for (auto dependent : node->get_control_dependents()) {
+            used |= in_graph(dependent);
+        }
+        if (used)
+            continue;
+        removed.insert(node);
+        for (size_t i = 0; i < node->get_input_size(); ++i) {
+            candidates.push_back(node->get_input_node_ptr(i));
+        }
+        for (const auto& depptr : node->get_control_dependencies()) {
+            candidates.push_back(depptr.get());
+        }
+    }
+
+    for (size_t g = 0; g < consumers.size(); g++) {
+        for (const auto& node : groups[g]) {
+            if (removed.count(node.get()) == 0) {
+                cache.insert(consumers[g], node);
+                new_ops.push_back(node);
+            }
+        }
+    }
+    for (auto node : removed) {
+        cache.erase(node);
+    }
+    return true;
+}
+
 }  // namespace
 
 OPENVINO_SUPPRESS_DEPRECATED_START
@@ -269,16 +405,43 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::nGraph, "Model::get_ordered_ops");
     lock_guard<mutex> lock(m_topological_sort_mutex);
 
-    NodeVector nodes;
+    auto& cache = m_shared_rt_info->get_ordered_ops_cache();
     if (m_shared_rt_info->get_use_topological_cache()) {
-        for (const auto& node : m_cached_ordered_ops) {
-            if (auto locked_node = node.lock()) {
-                nodes.emplace_back(locked_node);
+        return cache.get();
+    }
+
+    if (m_shared_rt_info->is_topological_cache_updatable()) {
+        std::vector<Node*> changed_consumers, released_producers, destroyed_nodes;
+        m_shared_rt_info->take_changes(changed_consumers, released_producers, destroyed_nodes);
+
+        // The custom sorter may order the nodes differently, the update keeps the order of the default one
+        using sorter_ptr = std::vector<std::shared_ptr<Node>> (*)(std::vector<std::shared_ptr<Node>>);
+        const auto sorter = m_topological_sorter.target<sorter_ptr>();
+        const bool default_sorter =
+            sorter && *sorter == ngraph::topological_sort<std::vector<std::shared_ptr<ov::Node>>>;
+
+        std::unordered_set<Node*> roots;
+        for (const auto& r : get_results())
+            roots.insert(r.get());
+        for (const auto& s : get_sinks())
+            roots.insert(s.get());
+        for (const auto& p : get_parameters())
+            roots.insert(p.get());
+
+        NodeVector new_ops;
+        if (default_sorter &&
+            update_ordered_ops(cache, changed_consumers, released_producers, destroyed_nodes, roots, new_ops)) {
+            for (const auto& node : new_ops) {
+                node->insert_info(m_shared_rt_info);
             }
+            m_cached_output_names.clear();
+            m_cached_op_names.clear();
+            m_shared_rt_info->set_use_topological_cache(true);
+            return cache.get();
         }
-        return nodes;
     }
 
+    NodeVector nodes;
     for (const auto& r : get_results()) {
         nodes.emplace_back(r);
     }
@@ -293,9 +456,8 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
 
     // Update nodes cache and update all nodes to have shared rt info
     // which belongs to the current Model.
-    m_cached_ordered_ops.clear();
+    cache.assign(order);
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
-        m_cached_ordered_ops.push_back(node);
         node->insert_info(m_shared_rt_info);
     });
     m_cached_output_names.clear();
@@ -965,8 +1127,12 @@ ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
     m_results.push_back(result);
     if (m_shared_rt_info->get_use_topological_cache()) {
         // Full update of topological cache is not needed, 'result' can be just inserted to the end
-        m_cached_ordered_ops.push_back(result);
+        auto& cache = m_shared_rt_info->get_ordered_ops_cache();
+        cache.insert(cache.end(), result);
         result->insert_info(m_shared_rt_info);  // Just for consistency, not required for Result nodes
+    } else {
+        // the recorded changes don't cover the new root
+        m_shared_rt_info->set_use_topological_cache(false);
     }
     return result->output(0);
 }
@@ -78,9 +78,15 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
+        // the producers may have lost their last consumer, the cached order is updated on the next request
+        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [this](const std::shared_ptr<SharedRTInfo>& info) {
+            info->record_destroyed_node(this);
+            for (descriptor::Input& input : m_inputs) {
+                if (input.has_output())
+                    info->record_released_producer(input.get_output().get_node().get());
+            }
+            for (const auto& dependency : m_control_dependencies)
+                info->record_released_producer(dependency.get());
         });
 
         for (descriptor::Input& input : m_inputs) {
@@ -0,0 +1,150 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <openvino/core/node.hpp>
+#include <unordered_map>
+
+namespace ov {
+/// \brief Cached topological order of the model nodes.
+///
+/// The nodes are kept in a list, so the node is inserted or erased without moving the rest of the order. Every
+/// entry has an integer label which grows along the list, the labels are compared to check whether one node
+/// precedes another. The label of the inserted node is taken from the gap between the neighbours. If there is no
+/// gap, the labels of a small neighbourhood are spread evenly, the neighbourhood grows until its labels are sparse
+/// enough, so the insertion costs amortized O(log N).
+///
+/// The nodes are stored as weak_ptr not to increase node ref counter to prevent the situation when
+/// node has no consumers but still exists in a graph.
+class OrderedOpsCache {
+public:
+    struct Entry {
+        std::weak_ptr<Node> node;
+        uint64_t label;
+    };
+    using Iterator = std::list<Entry>::iterator;
+
+    OrderedOpsCache() {
+        // the head entry has no node, so every node has a predecessor to take the label gap from
+        m_list.push_back(Entry{std::weak_ptr<Node>(), 0});
+    }
+
+    /// \brief Replaces the cached order by the full sort result.
+    void assign(const NodeVector& order) {
+        m_list.erase(std::next(m_list.begin()), m_list.end());
+        m_index.clear();
+        m_index.reserve(order.size());
+        const uint64_t step = max_label / (order.size() + 1);
+        uint64_t label = 0;
+        for (const auto& node : order) {
+            label += step;
+            m_index.emplace(node.get(), m_list.insert(m_list.end(), Entry{node, label}));
+        }
+        m_full_sort_count++;
+    }
+
+    /// \brief Returns the alive nodes in the cached order.
+    NodeVector get() const {
+        NodeVector nodes;
+        nodes.reserve(m_index.size());
+        for (const auto& entry : m_list) {
+            if (auto node = entry.node.lock())
+                nodes.emplace_back(std::move(node));
+        }
+        return nodes;
+    }
+
+    /// \brief Returns the entry of the node or end() if the node isn't cached.
+    Iterator find(Node* node) {
+        auto it = m_index.find(node);
+        return it == m_index.end() ? end() : it->second;
+    }
+
+    Iterator end() {
+        return m_list.end();
+    }
+
+    bool contains(Node* node) const {
+        return m_index.count(node) != 0;
+    }
+
+    size_t size() const {
+        return m_index.size();
+    }
+
+    /// \brief Inserts the node right before the cached position.
+    void insert(Iterator position, const std::shared_ptr<Node>& node) {
+        auto prev = std::prev(position);
+        if (upper_label(position) - prev->label < 2)
+            relabel(prev);
+        const uint64_t label = prev->label + (upper_label(position) - prev->label) / 2;
+        m_index.emplace(node.get(), m_list.insert(position, Entry{node, label}));
+    }
+
+    /// \brief Erases the node, the pointer may be dangling if the node is destroyed.
+    void erase(Node* node) {
+        auto it = m_index.find(node);
+        if (it == m_index.end())
+            return;
+        m_list.erase(it->second);
+        m_index.erase(it);
+    }
+
+    /// \brief Returns the number of the full sorts the order was built from, used by the tests.
+    size_t get_full_sort_count() const {
+        return m_full_sort_count;
+    }
+
+private:
+    static constexpr uint64_t max_label = uint64_t(1) << 62;
+
+    uint64_t upper_label(Iterator position) const {
+        return position == m_list.end() ? max_label : position->label;
+    }
+
+    // Spreads the labels around the entry, so there is a gap right after it. The range of the labels aligned to
+    // the power of two is doubled until it holds few enough entries: the allowed density drops for the larger
+    // ranges, which gives the amortized logarithmic cost of the insertion.
+    void relabel(Iterator entry) {
+        const uint64_t base = entry->label;
+        auto first = entry, last = entry;
+        size_t count = 1;
+        double threshold = 1.0;
+        for (size_t bits = 1; bits < 62; bits++) {
+            threshold *= 1.5;
+            const uint64_t range_begin = base & ~((uint64_t(1) << bits) - 1);
+            const uint64_t range_end = range_begin + (uint64_t(1) << bits);
+            while (first != m_list.begin() && std::prev(first)->label >= range_begin) {
+                --first;
+                count++;
+            }
+            while (std::next(last) != m_list.end() && std::next(last)->label < range_end) {
+                ++last;
+                count++;
+            }
+            // one more entry is going to be inserted
+            const uint64_t step = (uint64_t(1) << bits) / (count + 1);
+            if (step >= 2 && static_cast<double>(count + 1) < threshold) {
+                spread(first, std::next(last), range_begin, step);
+                return;
+            }
+        }
+        spread(m_list.begin(), m_list.end(), 0, max_label / (m_list.size() + 1));
+    }
+
+    static void spread(Iterator first, Iterator last, uint64_t label, uint64_t step) {
+        for (auto it = first; it != last; ++it, label += step)
+            it->label = label;
+    }
+
+    std::list<Entry> m_list;
+    std::unordered_map<Node*, Iterator> m_index;
+    size_t m_full_sort_count = 0;
+};
+}  // namespace ov
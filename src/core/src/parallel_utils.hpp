@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ov {
+
+inline size_t parallel_concurrency() {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Calls body(i) for every i in [0, work_amount) on up to parallel_concurrency() threads, the calling thread
+// takes part in the work. The first exception thrown by the body is rethrown after all the threads are joined.
+inline void parallel_run(size_t work_amount, const std::function<void(size_t)>& body) {
+    const size_t threads = std::min(work_amount, parallel_concurrency());
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&] {
+        for (size_t i = next++; i < work_amount; i = next++) {
+            try {
+                body(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error)
+                    error = std::current_exception();
+                next = work_amount;
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& thread : pool)
+        thread.join();
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}  // namespace ov
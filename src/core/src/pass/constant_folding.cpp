@@ -4,14 +4,23 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <cstring>
+#include <ngraph/runtime/reference/convert.hpp>
+#include <ngraph/runtime/reference/multiply.hpp>
+#include <ngraph/runtime/reference/subtract.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
+#include "ngraph/util.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
+#include "parallel_utils.hpp"
 
 using namespace std;
 
@@ -50,9 +59,369 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+using ParallelFor = std::function<void(size_t, const std::function<void(size_t)>&)>;
+
+void serial_run(size_t work_amount, const std::function<void(size_t)>& body) {
+    for (size_t i = 0; i < work_amount; i++)
+        body(i);
+}
+
+// the tensors smaller than that are folded by a single thread
+constexpr size_t parallel_fold_min_bytes = 1 << 20;
+// number of elements processed by one task of the folding kernels
+constexpr size_t fold_block_size = 1 << 16;
+
+size_t output_bytes(const ov::Node& node) {
+    size_t bytes = 0;
+    for (const auto& output : node.outputs()) {
+        if (output.get_partial_shape().is_static())
+            bytes += ov::shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    return bytes;
+}
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> allocate(const ov::element::Type& type, const ov::Shape& shape) {
+    return std::make_shared<ngraph::runtime::AlignedBuffer>(ov::shape_size(shape) * type.size());
+}
+
+// the Constant owns the buffer, the data is not copied
+std::shared_ptr<ov::op::v0::Constant> make_constant(const ov::element::Type& type,
+                                                    const ov::Shape& shape,
+                                                    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+    auto shared = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        buffer->get_ptr<char>(),
+        buffer->size(),
+        buffer);
+    return std::make_shared<ov::op::v0::Constant>(type, shape, shared);
+}
+
+template <typename TI, typename TO>
+void convert_blocks(const void* arg, void* out, size_t count, const ParallelFor& parallel_for) {
+    const auto src = static_cast<const TI*>(arg);
+    const auto dst = static_cast<TO*>(out);
+    parallel_for(ngraph::ceil_div(count, fold_block_size), [&](size_t block) {
+        const auto begin = block * fold_block_size;
+        ngraph::runtime::reference::convert(src + begin, dst + begin, std::min(fold_block_size, count - begin));
+    });
+}
+
+template <typename TO>
+bool convert_blocks_from(const ov::element::Type& type,
+                         const void* arg,
+                         void* out,
+                         size_t count,
+                         const ParallelFor& parallel_for) {
+    switch (type) {
+    case ov::element::Type_t::f16:
+        convert_blocks<ov::float16, TO>(arg, out, count, parallel_for);
+        return true;
+    case ov::element::Type_t::bf16:
+        convert_blocks<ov::bfloat16, TO>(arg, out, count, parallel_for);
+        return true;
+    case ov::element::Type_t::f32:
+        convert_blocks<float, TO>(arg, out, count, parallel_for);
+        return true;
+    case ov::element::Type_t::i8:
+        convert_blocks<int8_t, TO>(arg, out, count, parallel_for);
+        return true;
+    case ov::element::Type_t::u8:
+        convert_blocks<uint8_t, TO>(arg, out, count, parallel_for);
+        return true;
+    case ov::element::Type_t::i32:
+        convert_blocks<int32_t, TO>(arg, out, count, parallel_for);
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool fold_convert(const ov::op::v0::Convert& node,
+                  const ov::op::v0::Constant& arg,
+                  ov::OutputVector& replacements,
+                  const ParallelFor& parallel_for) {
+    const auto& out_type = node.get_destination_type();
+    const auto& shape = arg.get_shape();
+    auto buffer = allocate(out_type, shape);
+    const auto count = ov::shape_size(shape);
+    const auto& in_type = arg.get_element_type();
+    bool converted = false;
+    switch (out_type) {
+    case ov::element::Type_t::f32:
+        converted = convert_blocks_from<float>(in_type, arg.get_data_ptr(), buffer->get_ptr(), count, parallel_for);
+        break;
+    case ov::element::Type_t::f16:
+        converted = convert_blocks_from<ov::float16>(in_type, arg.get_data_ptr(), buffer->get_ptr(), count, parallel_for);
+        break;
+    default:
+        break;
+    }
+    if (converted)
+        replacements[0] = make_constant(out_type, shape, buffer);
+    return converted;
+}
+
+template <typename T>
+using BinaryKernel =
+    void (*)(const T*, const T*, T*, const ov::Shape&, const ov::Shape&, const ov::op::AutoBroadcastSpec&);
+
+// The output is split by the outermost axis, the inputs which are broadcasted along it are passed whole to every block
+template <typename T>
+void binary_blocks(const ov::op::v0::Constant& arg0,
+                   const ov::op::v0::Constant& arg1,
+                   T* out,
+                   const ov::Shape& out_shape,
+                   const ov::op::AutoBroadcastSpec& autob,
+                   BinaryKernel<T> kernel,
+                   const ParallelFor& parallel_for) {
+    const auto rows = out_shape.empty() ? size_t(1) : out_shape[0];
+    const auto row_size = rows == 0 ? size_t(0) : ov::shape_size(out_shape) / rows;
+    const auto rows_per_block = std::max(size_t(1), fold_block_size / std::max(size_t(1), row_size));
+
+    parallel_for(ngraph::ceil_div(rows, rows_per_block), [&](size_t block) {
+        const auto begin = block * rows_per_block;
+        const auto end = std::min(rows, begin + rows_per_block);
+        auto slice = [&](const ov::op::v0::Constant& arg, ov::Shape& shape) {
+            shape = arg.get_shape();
+            const auto data = arg.get_data_ptr<T>();
+            if (rows == 1 || shape.size() != out_shape.size() || shape[0] != rows)
+                return data;
+            shape[0] = end - begin;
+            return data + begin * (ov::shape_size(arg.get_shape()) / rows);
+        };
+        ov::Shape shape0, shape1;
+        const auto data0 = slice(arg0, shape0);
+        const auto data1 = slice(arg1, shape1);
+        kernel(data0, data1, out + begin * row_size, shape0, shape1, autob);
+    });
+}
+
+template <typename T>
+bool fold_binary(const ov::Node& node,
+                 const ov::op::v0::Constant& arg0,
+                 const ov::op::v0::Constant& arg1,
+                 const ov::op::AutoBroadcastSpec& autob,
+                 BinaryKernel<T> kernel,
+                 ov::OutputVector& replacements,
+                 const ParallelFor& parallel_for) {
+    const auto& type = node.get_output_element_type(0);
+    const auto& shape = node.get_output_shape(0);
+    auto buffer = allocate(type, shape);
+    binary_blocks<T>(arg0, arg1, buffer->get_ptr<T>(), shape, autob, kernel, parallel_for);
+    replacements[0] = make_constant(type, shape, buffer);
+    return true;
+}
+
+template <template <typename> class Kernel>
+bool fold_binary(const ov::op::util::BinaryElementwiseArithmetic& node,
+                 const ov::op::v0::Constant& arg0,
+                 const ov::op::v0::Constant& arg1,
+                 ov::OutputVector& replacements,
+                 const ParallelFor& parallel_for) {
+    const auto& autob = node.get_autob();
+    if (autob.m_type != ov::op::AutoBroadcastType::NUMPY && autob.m_type != ov::op::AutoBroadcastType::NONE)
+        return false;
+    // the kernels produce the type of the inputs
+    const auto& type = arg0.get_element_type();
+    if (arg1.get_element_type() != type || node.get_output_element_type(0) != type ||
+        node.get_output_partial_shape(0).is_dynamic())
+        return false;
+    switch (type) {
+    case ov::element::Type_t::f32:
+        return fold_binary<float>(node, arg0, arg1, autob, Kernel<float>::get(), replacements, parallel_for);
+    case ov::element::Type_t::f16:
+        return fold_binary<ov::float16>(node,
+                                        arg0,
+                                        arg1,
+                                        autob,
+                                        Kernel<ov::float16>::get(),
+                                        replacements,
+                                        parallel_for);
+    default:
+        return false;
+    }
+}
+
+template <typename T>
+struct MultiplyKernel {
+    static BinaryKernel<T> get() {
+        return &ngraph::runtime::reference::multiply<T>;
+    }
+};
+
+template <typename T>
+struct SubtractKernel {
+    static BinaryKernel<T> get() {
+        return &ngraph::runtime::reference::subtract<T>;
+    }
+};
+
+template <typename T>
+void permute_rows(const T* src,
+                  T* dst,
+                  const ov::Shape& out_shape,
+                  const std::vector<size_t>& src_strides,
+                  size_t begin,
+                  size_t end) {
+    // src_strides are the input strides in the order of the output axes, the odometer walks the outer output axes
+    const auto rank = out_shape.size();
+    const auto inner = out_shape.back();
+    const auto inner_stride = src_strides.back();
+    std::vector<size_t> index(rank - 1, 0);
+    size_t offset = 0;
+    for (size_t i = rank - 1, rest = begin; i-- > 0;) {
+        index[i] = rest % out_shape[i];
+        rest /= out_shape[i];
+        offset += index[i] * src_strides[i];
+    }
+    for (size_t row = begin; row < end; row++) {
+        T* out = dst + row * inner;
+        if (inner_stride == 1) {
+            std::memcpy(out, src + offset, inner * sizeof(T));
+        } else {
+            for (size_t j = 0; j < inner; j++)
+                out[j] = src[offset + j * inner_stride];
+        }
+        for (size_t i = rank - 1; i-- > 0;) {
+            offset += src_strides[i];
+            if (++index[i] < out_shape[i])
+                break;
+            offset -= index[i] * src_strides[i];
+            index[i] = 0;
+        }
+    }
+}
+
+template <typename T>
+void permute_blocks(const void* arg,
+                    void* out,
+                    const ov::Shape& out_shape,
+                    const std::vector<size_t>& src_strides,
+                    const ParallelFor& parallel_for) {
+    const auto rows = ov::shape_size(out_shape) / out_shape.back();
+    const auto rows_per_block = std::max(size_t(1), fold_block_size / std::max(size_t(1), out_shape.back()));
+    parallel_for(ngraph::ceil_div(rows, rows_per_block), [&](size_t block) {
+        const auto begin = block * rows_per_block;
+        permute_rows(static_cast<const T*>(arg),
+                     static_cast<T*>(out),
+                     out_shape,
+                     src_strides,
+                     begin,
+                     std::min(rows, begin + rows_per_block));
+    });
+}
+
+bool fold_transpose(const ov::op::v1::Transpose& node,
+                    const ov::op::v0::Constant& arg,
+                    const ov::op::v0::Constant& order_const,
+                    ov::OutputVector& replacements,
+                    const ParallelFor& parallel_for) {
+    const auto& type = arg.get_element_type();
+    const auto& in_shape = arg.get_shape();
+    if (in_shape.empty() || type.bitwidth() < 8 || node.get_output_partial_shape(0).is_dynamic())
+        return false;
+    auto order = order_const.cast_vector<int64_t>();
+    if (order.empty()) {
+        for (size_t i = in_shape.size(); i-- > 0;)
+            order.push_back(static_cast<int64_t>(i));
+    }
+    const auto& out_shape = node.get_output_shape(0);
+    if (order.size() != in_shape.size() || ov::shape_size(out_shape) == 0)
+        return false;
+
+    std::vector<size_t> in_strides(in_shape.size(), 1);
+    for (size_t i = in_shape.size() - 1; i-- > 0;)
+        in_strides[i] = in_strides[i + 1] * in_shape[i + 1];
+    std::vector<size_t> src_strides(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        src_strides[i] = in_strides[order[i]];
+
+    auto buffer = allocate(type, out_shape);
+    switch (type.size()) {
+    case 1:
+        permute_blocks<uint8_t>(arg.get_data_ptr(), buffer->get_ptr(), out_shape, src_strides, parallel_for);
+        break;
+    case 2:
+        permute_blocks<uint16_t>(arg.get_data_ptr(), buffer->get_ptr(), out_shape, src_strides, parallel_for);
+        break;
+    case 4:
+        permute_blocks<uint32_t>(arg.get_data_ptr(), buffer->get_ptr(), out_shape, src_strides, parallel_for);
+        break;
+    case 8:
+        permute_blocks<uint64_t>(arg.get_data_ptr(), buffer->get_ptr(), out_shape, src_strides, parallel_for);
+        break;
+    default:
+        return false;
+    }
+    replacements[0] = make_constant(type, out_shape, buffer);
+    return true;
+}
+
+// the derived operations (e.g. TypeRelaxed) may override the output types, so they are left to constant_fold
+template <typename T>
+const T* as_exact_type(const ov::Node* node) {
+    return node->get_type_info() == T::get_type_info_static() ? static_cast<const T*>(node) : nullptr;
+}
+
+/**
+ * \brief Folds the hot operations of the weights decompression sub-graphs. Unlike Node::constant_fold the
+ * inputs are not copied and the result buffer is owned by the Constant directly, large tensors are split
+ * between threads by parallel_for. Reshape, Squeeze and Unsqueeze already fold to the views of the input data.
+ *
+ * \return true if the node was folded, false if it has to be folded by Node::constant_fold.
+ */
+bool fold_fast(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements, const ParallelFor& parallel_for) {
+    if (ov::pass::constant_folding_is_disabled(node))
+        return false;
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> args;
+    for (const auto& input : node->input_values()) {
+        auto constant = ov::as_type_ptr<ov::op::v0::Constant>(input.get_node_shared_ptr());
+        if (!constant || ov::shape_size(constant->get_shape()) == 0)
+            return false;
+        args.push_back(constant);
+    }
+    const auto& run = output_bytes(*node) < parallel_fold_min_bytes ? ParallelFor(serial_run) : parallel_for;
+
+    if (const auto convert = as_exact_type<ov::op::v0::Convert>(node.get())) {
+        return fold_convert(*convert, *args[0], replacements, run);
+    } else if (const auto multiply = as_exact_type<ov::op::v1::Multiply>(node.get())) {
+        return fold_binary<MultiplyKernel>(*multiply, *args[0], *args[1], replacements, run);
+    } else if (const auto subtract = as_exact_type<ov::op::v1::Subtract>(node.get())) {
+        return fold_binary<SubtractKernel>(*subtract, *args[0], *args[1], replacements, run);
+    } else if (const auto transpose = as_exact_type<ov::op::v1::Transpose>(node.get())) {
+        return fold_transpose(*transpose, *args[0], *args[1], replacements, run);
+    }
+    return false;
+}
+
+bool fold_node(const std::shared_ptr<ov::Node>& node, ov::OutputVector& replacements, const ParallelFor& parallel_for) {
+    return fold_fast(node, replacements, parallel_for) || node->constant_fold(replacements, node->input_values());
+}
+
+/**
+ * \brief Check if the node can be folded on a wave of the parallel folding: all its inputs are Constants.
+ * Operations without a standard opset are left to the serial folding, their evaluate may be not thread safe.
+ */
+bool is_wave_foldable(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_input_size() == 0 || ov::is_type<ov::op::v0::Result>(node) || ov::is_type<ov::op::Sink>(node) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node) || ov::pass::constant_folding_is_disabled(node))
+        return false;
+    const auto version = node->get_type_info().version_id;
+    if (!version || std::strncmp(version, "opset", 5) != 0)
+        return false;
+    const auto& inputs = node->input_values();
+    return std::all_of(inputs.begin(), inputs.end(), [](const ov::Output<ov::Node>& input) {
+        return ov::is_type<ov::op::v0::Constant>(input.get_node());
+    });
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
     bool rewritten = pre_calculated_values_folding(model);
+    if (m_parallel) {
+        rewritten |= parallel_folding(model, rewritten);
+    }
 
     for (const auto& node : model->get_ordered_ops()) {
         if (rewritten) {
@@ -61,27 +430,11 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
         OutputVector replacements(node->get_output_size());
 
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
-            }
+        // the dedicated kernels and the threads are used only in the parallel mode
+        const bool folded = m_parallel ? fold_node(node, replacements, ov::parallel_run)
+                                       : node->constant_fold(replacements, node->input_values());
+        if (folded) {
+            rewritten |= replace_outputs(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -96,6 +449,99 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Model>& model, bool revalidate) {
+    const auto ordered_ops = model->get_ordered_ops();
+    std::unordered_map<const Node*, size_t> topological_index;
+    std::vector<std::shared_ptr<Node>> wave;
+    for (const auto& node : ordered_ops) {
+        topological_index.emplace(node.get(), topological_index.size());
+        if (is_wave_foldable(node))
+            wave.push_back(node);
+    }
+
+    bool rewritten = false;
+    while (!wave.empty()) {
+        if (revalidate) {
+            for (const auto& node : wave)
+                node->validate_and_infer_types();
+        }
+
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), 0);
+        auto fold = [&](size_t i, const ParallelFor& parallel_for) {
+            replacements[i].resize(wave[i]->get_output_size());
+            folded[i] = fold_node(wave[i], replacements[i], parallel_for);
+        };
+        // the large nodes are folded one by one with all the threads, the small ones are spread between the threads
+        std::vector<size_t> small_nodes;
+        for (size_t i = 0; i < wave.size(); i++) {
+            if (output_bytes(*wave[i]) >= parallel_fold_min_bytes) {
+                fold(i, ov::parallel_run);
+            } else {
+                small_nodes.push_back(i);
+            }
+        }
+        ov::parallel_run(small_nodes.size(), [&](size_t i) {
+            fold(small_nodes[i], serial_run);
+        });
+
+        // graph is modified by a single thread in the topological order, the consumers whose inputs all became
+        // constants form the next wave
+        std::unordered_set<const Node*> next_wave_nodes;
+        std::vector<std::shared_ptr<Node>> next_wave;
+        for (size_t i = 0; i < wave.size(); i++) {
+            if (!folded[i])
+                continue;
+            std::vector<std::shared_ptr<Node>> consumers;
+            for (const auto& output : wave[i]->outputs()) {
+                for (const auto& input : output.get_target_inputs())
+                    consumers.push_back(input.get_node()->shared_from_this());
+            }
+            rewritten |= replace_outputs(wave[i], replacements[i]);
+            for (const auto& consumer : consumers) {
+                if (topological_index.count(consumer.get()) && !next_wave_nodes.count(consumer.get()) &&
+                    is_wave_foldable(consumer)) {
+                    next_wave_nodes.insert(consumer.get());
+                    next_wave.push_back(consumer);
+                }
+            }
+        }
+        std::sort(next_wave.begin(),
+                  next_wave.end(),
+                  [&](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
+                      return topological_index.at(a.get()) < topological_index.at(b.get());
+                  });
+        wave = std::move(next_wave);
+        revalidate = revalidate || rewritten;
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                    const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
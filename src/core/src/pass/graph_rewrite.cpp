@@ -16,6 +16,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/pass/profiler.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -87,6 +88,7 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
+    const auto profiler = PassProfiler::get_active();
 
     // Check that all Matchers in MatcherPasses has type bases root node
     bool all_roots_has_type = true;
@@ -147,6 +149,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        if (status && profiler)
+            profiler->add_matcher_hit();
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
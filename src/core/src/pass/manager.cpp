@@ -20,6 +20,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "openvino/pass/profiler.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
@@ -32,6 +33,43 @@ PerfCounters& perf_counters() {
     static PerfCounters counters;
     return counters;
 }
+
+// Records the pass run into the active profiler, the pass skipped by the static shape check is recorded as
+// unchanged one
+class ProfiledPass {
+public:
+    ProfiledPass(PassProfiler* profiler, const std::string& name, const std::shared_ptr<Model>& model)
+        : m_profiler(profiler),
+          m_model(model) {
+        if (m_profiler)
+            m_record = m_profiler->begin_pass(name, model->get_friendly_name(), model->get_ordered_ops().size());
+    }
+
+    ~ProfiledPass() {
+        if (!m_profiler)
+            return;
+        // the model may be inconsistent if the pass has thrown
+        size_t nodes_after = 0;
+        try {
+            nodes_after = m_model->get_ordered_ops().size();
+        } catch (...) {
+        }
+        m_profiler->end_pass(m_record, nodes_after, m_changed);
+    }
+
+    ProfiledPass(const ProfiledPass&) = delete;
+    ProfiledPass& operator=(const ProfiledPass&) = delete;
+
+    void set_changed(bool changed) {
+        m_changed = changed;
+    }
+
+private:
+    PassProfiler* m_profiler;
+    const std::shared_ptr<Model>& m_model;
+    size_t m_record = 0;
+    bool m_changed = false;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -61,6 +99,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     ngraph::stopwatch overall_timer;
     overall_timer.start();
     bool function_changed = false;
+    auto profiler = PassProfiler::get_active();
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -70,6 +109,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::nGraphPass_LT, pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
+        ProfiledPass profiled_pass(profiler, pass->get_name(), func);
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
@@ -82,6 +122,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             // GraphRewrite is a temporary container for MatcherPass to make execution
             // on on entire ngraph::Function
             function_changed = GraphRewrite(matcher_pass).run_on_model(func);
+            profiled_pass.set_changed(function_changed);
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -98,6 +139,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 }
             } else {
                 function_changed = function_pass->run_on_model(func);
+                profiled_pass.set_changed(function_changed);
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
@@ -105,9 +147,12 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                              << "model is dynamic. Skipping this transformation";
                 continue;
             }
+            bool nodes_changed = false;
             for (const shared_ptr<Node>& n : func->get_ops()) {
-                function_changed |= node_pass->run_on_node(n);
+                nodes_changed |= node_pass->run_on_node(n);
             }
+            function_changed |= nodes_changed;
+            profiled_pass.set_changed(nodes_changed);
         }
 
         if (m_visualize) {
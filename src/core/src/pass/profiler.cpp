@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <map>
+
+namespace ov {
+namespace pass {
+namespace {
+struct ThreadState {
+    PassProfiler* profiler = nullptr;
+    // records of the passes which are running on this thread, the innermost one is the last
+    std::vector<size_t> open_records;
+};
+
+ThreadState& thread_state() {
+    static thread_local ThreadState state;
+    return state;
+}
+
+int64_t steady_now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void write_json_string(std::ostream& stream, const std::string& str) {
+    stream << '"';
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            stream << "\\\"";
+            break;
+        case '\\':
+            stream << "\\\\";
+            break;
+        case '\n':
+            stream << "\\n";
+            break;
+        case '\t':
+            stream << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec
+                       << std::setfill(' ');
+            } else {
+                stream << c;
+            }
+        }
+    }
+    stream << '"';
+}
+}  // namespace
+}  // namespace pass
+}  // namespace ov
+
+ov::pass::PassProfiler::Scope::Scope(const std::shared_ptr<PassProfiler>& profiler)
+    : m_previous(nullptr),
+      m_active(profiler != nullptr) {
+    if (!m_active)
+        return;
+    auto& state = thread_state();
+    m_previous = state.profiler;
+    m_previous_open_records = std::move(state.open_records);
+    state.profiler = profiler.get();
+    state.open_records.clear();
+}
+
+ov::pass::PassProfiler::Scope::~Scope() {
+    if (!m_active)
+        return;
+    auto& state = thread_state();
+    state.profiler = m_previous;
+    state.open_records = std::move(m_previous_open_records);
+}
+
+ov::pass::PassProfiler::PassProfiler() : m_start_us(steady_now_us()) {}
+
+ov::pass::PassProfiler* ov::pass::PassProfiler::get_active() {
+    return thread_state().profiler;
+}
+
+int64_t ov::pass::PassProfiler::now_us() const {
+    return steady_now_us() - m_start_us;
+}
+
+size_t ov::pass::PassProfiler::get_thread_index() {
+    const auto id = std::this_thread::get_id();
+    auto it = std::find(m_threads.begin(), m_threads.end(), id);
+    if (it != m_threads.end())
+        return static_cast<size_t>(it - m_threads.begin());
+    m_threads.push_back(id);
+    return m_threads.size() - 1;
+}
+
+size_t ov::pass::PassProfiler::begin_pass(const std::string& name, const std::string& model, size_t nodes_before) {
+    auto& state = thread_state();
+    PassProfileRecord record;
+    record.name = name;
+    record.model = model;
+    record.depth = state.open_records.size();
+    record.nodes_before = nodes_before;
+
+    size_t index;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        record.thread = get_thread_index();
+        record.start_us = now_us();
+        index = m_records.size();
+        m_records.push_back(std::move(record));
+    }
+    state.open_records.push_back(index);
+    return index;
+}
+
+void ov::pass::PassProfiler::end_pass(size_t record, size_t nodes_after, bool changed) {
+    auto& state = thread_state();
+    if (!state.open_records.empty() && state.open_records.back() == record)
+        state.open_records.pop_back();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& entry = m_records.at(record);
+    entry.duration_us = now_us() - entry.start_us;
+    entry.nodes_after = nodes_after;
+    entry.changed = changed;
+}
+
+void ov::pass::PassProfiler::add_matcher_hit() {
+    const auto& state = thread_state();
+    if (state.open_records.empty())
+        return;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_records[state.open_records.back()].matcher_hits++;
+}
+
+std::vector<ov::pass::PassProfileRecord> ov::pass::PassProfiler::get_records() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_records;
+}
+
+void ov::pass::PassProfiler::dump_chrome_trace(std::ostream& stream) const {
+    const auto records = get_records();
+    stream << "{\"traceEvents\":[";
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto& record = records[i];
+        stream << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+        write_json_string(stream, record.name);
+        stream << ",\"cat\":\"pass\",\"ph\":\"X\",\"pid\":0,\"tid\":" << record.thread << ",\"ts\":" << record.start_us
+               << ",\"dur\":" << record.duration_us << ",\"args\":{\"model\":";
+        write_json_string(stream, record.model);
+        stream << ",\"depth\":" << record.depth << ",\"nodes_before\":" << record.nodes_before
+               << ",\"nodes_after\":" << record.nodes_after << ",\"matcher_hits\":" << record.matcher_hits
+               << ",\"changed\":" << (record.changed ? "true" : "false") << "}}";
+    }
+    stream << "\n]}\n";
+}
+
+void ov::pass::PassProfiler::dump_summary(std::ostream& stream) const {
+    struct Summary {
+        std::string name;
+        size_t runs = 0;
+        int64_t total_us = 0;
+        int64_t max_us = 0;
+        size_t matcher_hits = 0;
+        int64_t nodes_delta = 0;
+    };
+    std::map<std::string, Summary> by_name;
+    for (const auto& record : get_records()) {
+        auto& summary = by_name[record.name];
+        summary.name = record.name;
+        summary.runs++;
+        summary.total_us += record.duration_us;
+        summary.max_us = std::max(summary.max_us, record.duration_us);
+        summary.matcher_hits += record.matcher_hits;
+        summary.nodes_delta += static_cast<int64_t>(record.nodes_after) - static_cast<int64_t>(record.nodes_before);
+    }
+    std::vector<Summary> summaries;
+    summaries.reserve(by_name.size());
+    for (auto& item : by_name)
+        summaries.push_back(std::move(item.second));
+    std::stable_sort(summaries.begin(), summaries.end(), [](const Summary& lhs, const Summary& rhs) {
+        return lhs.total_us > rhs.total_us;
+    });
+
+    stream << std::setw(12) << "total_us" << std::setw(12) << "max_us" << std::setw(8) << "runs" << std::setw(10)
+           << "hits" << std::setw(10) << "nodes" << "  pass\n";
+    for (const auto& summary : summaries) {
+        stream << std::setw(12) << summary.total_us << std::setw(12) << summary.max_us << std::setw(8) << summary.runs
+               << std::setw(10) << summary.matcher_hits << std::setw(10) << summary.nodes_delta << "  "
+               << summary.name << "\n";
+    }
+}
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <cstdint>
 #include <fstream>
+#include <functional>
 #include <ngraph/variant.hpp>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
@@ -18,6 +19,8 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
+#include "openvino/util/common_util.hpp"
+#include "parallel_utils.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -1004,7 +1007,9 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    // the duplicated constants are not compressed for the hash calculation, it would only cost an extra pass over
+    // the weights
+    ConstantWriter constant_write_handler(bin_file, !deterministic);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1183,18 +1188,9 @@ public:
     }
 
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
-
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
-        }
+        // the weights come in one write per constant, the big ones are hashed by chunks in parallel
+        const auto hash = ov::util::hash_data_chunked(s, static_cast<size_t>(n), ov::parallel_run);
+        m_res = hash_combine(m_res, hash);
         return n;
     }
 };
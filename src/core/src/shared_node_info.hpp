@@ -5,23 +5,107 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <vector>
+
+#include "ordered_ops_cache.hpp"
 
 namespace ov {
 class SharedRTInfo {
 public:
     SharedRTInfo() : m_use_topological_cache(false) {}
 
+    /// \brief Sets the state of the topological cache. The recorded changes are dropped in both cases:
+    /// the valid cache has no changes, the invalid cache is rebuilt by the full sort.
     void set_use_topological_cache(bool status) {
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_use_topological_cache = status;
+        m_changed_consumers.clear();
+        m_released_producers.clear();
+        m_destroyed_nodes.clear();
     }
 
+    /// \brief Returns true if the cached order is valid and no edges have been changed since it was built.
     bool get_use_topological_cache() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_use_topological_cache && m_changed_consumers.empty() && m_released_producers.empty() &&
+               m_destroyed_nodes.empty();
+    }
+
+    /// \brief Returns true if the cached order can be updated by the recorded changes instead of the full sort.
+    bool is_topological_cache_updatable() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
         return m_use_topological_cache;
     }
 
+    /// \brief Records that the consumer input was connected to another output, the previous producer may have
+    /// lost its last consumer.
+    void record_edge_change(Node* consumer, Node* old_producer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_use_topological_cache)
+            return;
+        m_changed_consumers.push_back(consumer);
+        if (old_producer)
+            m_released_producers.push_back(old_producer);
+        limit_changes();
+    }
+
+    /// \brief Records the producer which has lost a consumer because the consumer was destroyed.
+    void record_released_producer(Node* producer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_use_topological_cache)
+            return;
+        m_released_producers.push_back(producer);
+        limit_changes();
+    }
+
+    /// \brief Records the destroyed node to erase it from the cached order.
+    void record_destroyed_node(Node* node) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_use_topological_cache)
+            return;
+        m_destroyed_nodes.push_back(node);
+        limit_changes();
+    }
+
+    /// \brief Moves the recorded changes out. The pointers may be dangling, the destroyed nodes are erased from
+    /// the cached order first, then the rest is only compared with the cached nodes.
+    void take_changes(std::vector<Node*>& changed_consumers,
+                      std::vector<Node*>& released_producers,
+                      std::vector<Node*>& destroyed_nodes) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        changed_consumers = std::move(m_changed_consumers);
+        released_producers = std::move(m_released_producers);
+        destroyed_nodes = std::move(m_destroyed_nodes);
+        m_changed_consumers.clear();
+        m_released_producers.clear();
+        m_destroyed_nodes.clear();
+    }
+
+    /// \brief The cached order of the model nodes, it is guarded by the model.
+    OrderedOpsCache& get_ordered_ops_cache() {
+        return m_ordered_ops;
+    }
+
 private:
+    // the graph which is rewritten without querying the order is sorted from scratch
+    void limit_changes() {
+        constexpr size_t max_changes = 1 << 16;
+        if (m_changed_consumers.size() + m_released_producers.size() + m_destroyed_nodes.size() > max_changes) {
+            m_use_topological_cache = false;
+            m_changed_consumers.clear();
+            m_released_producers.clear();
+            m_destroyed_nodes.clear();
+        }
+    }
+
     bool m_use_topological_cache;
+    std::vector<Node*> m_changed_consumers;
+    std::vector<Node*> m_released_producers;
+    std::vector<Node*> m_destroyed_nodes;
+    OrderedOpsCache m_ordered_ops;
+    mutable std::mutex m_mutex;
 };
 }  // namespace ov
@@ -3522,3 +3522,119 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+namespace {
+// folds the model by Node::constant_fold only, as the reference for the dedicated folding kernels
+void reference_fold(const std::shared_ptr<Function>& f) {
+    for (const auto& node : f->get_ordered_ops()) {
+        if (ov::is_type<op::Constant>(node) || ov::is_type<op::Result>(node))
+            continue;
+        OutputVector replacements(node->get_output_size());
+        if (!node->constant_fold(replacements, node->input_values()))
+            continue;
+        for (size_t i = 0; i < replacements.size(); i++)
+            node->output(i).replace(replacements[i]);
+    }
+}
+
+// the models are folded in the parallel mode, where the tensors larger than 1MB are split between the threads
+void check_parallel_folding(const std::function<std::shared_ptr<Function>()>& make_model) {
+    auto f_ref = make_model();
+    auto f = make_model();
+    vector<string> names;
+    for (const auto& result : f->get_results())
+        names.push_back(result->get_input_node_ptr(0)->get_friendly_name());
+    reference_fold(f_ref);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(true);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(f_ref->get_results().size(), f->get_results().size());
+    for (size_t i = 0; i < f->get_results().size(); i++) {
+        auto ref_const = ov::as_type_ptr<op::Constant>(f_ref->get_results()[i]->get_input_node_shared_ptr(0));
+        auto new_const = ov::as_type_ptr<op::Constant>(f->get_results()[i]->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(ref_const);
+        ASSERT_TRUE(new_const);
+        ASSERT_GT(new_const->get_byte_size(), size_t(1 << 20));
+        ASSERT_EQ(names[i], new_const->get_friendly_name());
+        ASSERT_EQ(ref_const->get_element_type(), new_const->get_element_type());
+        ASSERT_EQ(ref_const->get_shape(), new_const->get_shape());
+        ASSERT_EQ(0, std::memcmp(ref_const->get_data_ptr(), new_const->get_data_ptr(), ref_const->get_byte_size()));
+    }
+}
+}  // namespace
+
+TEST(constant_folding, parallel_convert_large_f16_to_f32) {
+    check_parallel_folding([] {
+        Shape shape_in{512, 1024};
+        vector<float16> values_in(shape_size(shape_in));
+        for (size_t i = 0; i < values_in.size(); i++)
+            values_in[i] = float16(static_cast<float>(i % 2048) / 8.f - 128.f);
+
+        auto constant = make_shared<op::Constant>(element::f16, shape_in, values_in);
+        auto convert = make_shared<op::Convert>(constant, element::f32);
+        convert->set_friendly_name("test");
+        return make_shared<Function>(convert, ParameterVector{});
+    });
+}
+
+TEST(constant_folding, parallel_multiply_subtract_large_broadcast) {
+    check_parallel_folding([] {
+        Shape shape_in{512, 1024};
+        vector<float> values_in(shape_size(shape_in));
+        for (size_t i = 0; i < values_in.size(); i++)
+            values_in[i] = static_cast<float>(i % 255);
+        vector<float> zero_points(shape_in[1]);
+        for (size_t i = 0; i < zero_points.size(); i++)
+            zero_points[i] = static_cast<float>(i % 7);
+        vector<float> scales(shape_in[0]);
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = 0.5f + static_cast<float>(i % 5);
+
+        auto constant_in = make_shared<op::Constant>(element::f32, shape_in, values_in);
+        auto constant_zp = make_shared<op::Constant>(element::f32, Shape{shape_in[1]}, zero_points);
+        auto constant_scale = make_shared<op::Constant>(element::f32, Shape{shape_in[0], 1}, scales);
+        auto subtract = make_shared<op::v1::Subtract>(constant_in, constant_zp);
+        auto multiply = make_shared<op::v1::Multiply>(subtract, constant_scale);
+        multiply->set_friendly_name("test");
+        return make_shared<Function>(multiply, ParameterVector{});
+    });
+}
+
+TEST(constant_folding, parallel_transpose_large) {
+    check_parallel_folding([] {
+        Shape shape_in{64, 64, 128};
+        vector<float> values_in(shape_size(shape_in));
+        std::iota(values_in.begin(), values_in.end(), 0.f);
+
+        auto constant_in = make_shared<op::Constant>(element::f32, shape_in, values_in);
+        auto constant_perm = make_shared<op::Constant>(element::i64, Shape{3}, vector<int64_t>{2, 0, 1});
+        auto transpose = make_shared<op::Transpose>(constant_in, constant_perm);
+        transpose->set_friendly_name("test");
+        return make_shared<Function>(transpose, ParameterVector{});
+    });
+}
+
+TEST(constant_folding, parallel_folding_matches_reference) {
+    check_parallel_folding([] {
+        ResultVector results;
+        for (size_t branch = 0; branch < 8; branch++) {
+            // weights decompression sub-graph: Convert -> Subtract -> Multiply -> Transpose
+            const Shape shape{branch % 2 ? size_t(2048) : size_t(1280), 256};
+            vector<uint8_t> weights(shape_size(shape));
+            for (size_t i = 0; i < weights.size(); i++)
+                weights[i] = static_cast<uint8_t>((i * 7 + branch) % 256);
+            auto constant = make_shared<op::Constant>(element::u8, shape, weights);
+            auto convert = make_shared<op::Convert>(constant, element::f32);
+            auto zero_point = op::Constant::create(element::f32, Shape{1, shape[1]}, vector<float>(shape[1], 128.f));
+            auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+            auto scale = op::Constant::create(element::f32, Shape{shape[0], 1}, vector<float>(shape[0], 0.25f));
+            auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+            auto transpose =
+                make_shared<op::Transpose>(multiply, op::Constant::create(element::i64, Shape{2}, {1, 0}));
+            transpose->set_friendly_name("weights_" + std::to_string(branch));
+            results.push_back(make_shared<op::Result>(transpose));
+        }
+        return make_shared<Function>(results, ParameterVector{});
+    });
+}
@@ -12,6 +12,9 @@
 #include "common_test_utils/graph_comparator.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 TEST(model, get_input_by_tensor_name) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
@@ -1579,6 +1582,177 @@ TEST(model, topological_sort_caching_shared_nodes) {
     ASSERT_FALSE(f2_shared_info->get_use_topological_cache());
 }
 
+namespace {
+// Checks that the ordered ops are the nodes of the full sort and every node follows its inputs
+void check_ordered_ops(const std::shared_ptr<ov::Model>& f) {
+    const auto ordered_ops = f->get_ordered_ops();
+
+    ov::NodeVector roots;
+    for (const auto& result : f->get_results())
+        roots.push_back(result);
+    for (const auto& sink : f->get_sinks())
+        roots.push_back(sink);
+    for (const auto& param : f->get_parameters())
+        roots.push_back(param);
+    const auto sorted_ops = ov::topological_sort(roots);
+    ASSERT_EQ(std::set<std::shared_ptr<ov::Node>>(ordered_ops.begin(), ordered_ops.end()),
+              std::set<std::shared_ptr<ov::Node>>(sorted_ops.begin(), sorted_ops.end()));
+
+    std::unordered_set<ov::Node*> visited;
+    for (const auto& node : ordered_ops) {
+        for (size_t i = 0; i < node->get_input_size(); i++) {
+            ASSERT_TRUE(visited.count(node->get_input_node_ptr(i))) << node << " precedes its input " << i;
+        }
+        visited.insert(node.get());
+    }
+}
+
+std::shared_ptr<ov::Model> create_relu_chain(size_t length, ov::NodeVector& relus) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    std::shared_ptr<ov::Node> op = arg0;
+    for (size_t i = 0; i < length; i++) {
+        op = std::make_shared<ov::opset8::Relu>(op);
+        relus.push_back(op);
+    }
+    auto result = std::make_shared<ov::opset8::Result>(op);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+}
+
+class ReplaceEveryNthRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReplaceEveryNthRelu");
+    explicit ReplaceEveryNthRelu(size_t step) {
+        auto relu = ov::pass::pattern::wrap_type<ov::opset8::Relu>();
+        auto counter = std::make_shared<size_t>(0);
+        ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+            if ((*counter)++ % step != 0)
+                return false;
+            auto node = m.get_match_root();
+            auto new_relu = std::make_shared<ov::opset8::Relu>(node->input_value(0));
+            ov::replace_node(node, new_relu);
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "ReplaceEveryNthRelu"), callback);
+    }
+};
+}  // namespace
+
+TEST(model, topological_sort_caching_update_inserted_nodes) {
+    ov::NodeVector relus;
+    auto f = create_relu_chain(64, relus);
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // insert the node between relu10 and relu11
+    auto abs = std::make_shared<ov::opset8::Abs>(relus[10]);
+    relus[11]->input(0).replace_source_output(abs);
+    // replace relu30 by the new subgraph which consumes both the previous node and the distant one
+    auto add = std::make_shared<ov::opset8::Add>(relus[29], relus[5]);
+    auto neg = std::make_shared<ov::opset8::Negative>(add);
+    ov::replace_node(relus[30], neg);
+
+    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 68);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_update_removed_nodes) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    ov::NodeVector relus;
+    std::shared_ptr<ov::Node> op = arg0;
+    for (size_t i = 0; i < 64; i++) {
+        op = std::make_shared<ov::opset8::Relu>(op);
+        relus.push_back(op);
+    }
+    // the side branch relu20 -> abs -> abs -> add(relu40, abs) -> relu41 is removed below
+    auto abs1 = std::make_shared<ov::opset8::Abs>(relus[20]);
+    auto abs2 = std::make_shared<ov::opset8::Abs>(abs1);
+    auto add = std::make_shared<ov::opset8::Add>(relus[40], abs2);
+    relus[41]->input(0).replace_source_output(add);
+    auto result = std::make_shared<ov::opset8::Result>(op);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_EQ(f->get_ordered_ops().size(), 69);
+
+    // the removed nodes are still alive
+    relus[41]->input(0).replace_source_output(relus[40]);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 66);
+
+    // the removed nodes are destroyed
+    auto abs3 = std::make_shared<ov::opset8::Abs>(relus[50]);
+    relus[51]->input(0).replace_source_output(abs3);
+    ASSERT_EQ(f->get_ordered_ops().size(), 67);
+    abs3.reset();
+    relus[51]->input(0).replace_source_output(relus[50]);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 66);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, topological_sort_caching_update_out_of_order) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    ov::NodeVector branch_a, branch_b;
+    std::shared_ptr<ov::Node> a = arg0, b = arg0;
+    for (size_t i = 0; i < 32; i++) {
+        a = std::make_shared<ov::opset8::Relu>(a);
+        branch_a.push_back(a);
+        b = std::make_shared<ov::opset8::Abs>(b);
+        branch_b.push_back(b);
+    }
+    auto add = std::make_shared<ov::opset8::Add>(a, b);
+    auto result = std::make_shared<ov::opset8::Result>(add);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_EQ(f->get_ordered_ops().size(), 67);
+
+    // the first branch precedes the second one in the order, so its node can't be simply moved
+    branch_a[5]->input(0).replace_source_output(branch_b[3]);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 62);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, ordered_ops_update_without_full_sort) {
+    ov::NodeVector relus;
+    auto f = create_relu_chain(1024, relus);
+    relus.clear();
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_EQ(shared_info->get_ordered_ops_cache().get_full_sort_count(), 1);
+
+    ov::pass::Manager manager;
+    // every pass replaces a part of the nodes and requests the order
+    for (size_t i = 0; i < 20; i++) {
+        manager.register_pass<ReplaceEveryNthRelu>(64);
+    }
+    manager.run_passes(f);
+    check_ordered_ops(f);
+    ASSERT_EQ(f->get_ordered_ops().size(), 1026);
+    // the cached order is updated by every pass instead of sorting the whole graph again
+    ASSERT_EQ(shared_info->get_ordered_ops_cache().get_full_sort_count(), 1);
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
+TEST(model, ordered_ops_update_repeated_insertion) {
+    ov::NodeVector relus;
+    auto f = create_relu_chain(64, relus);
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+
+    // every node is inserted right before the same consumer, so the free labels around it run out
+    for (size_t i = 0; i < 200; i++) {
+        auto abs = std::make_shared<ov::opset8::Abs>(relus[33]->input_value(0));
+        relus[33]->input(0).replace_source_output(abs);
+        ASSERT_EQ(f->get_ordered_ops().size(), 67 + i);
+    }
+    check_ordered_ops(f);
+    ASSERT_EQ(shared_info->get_ordered_ops_cache().get_full_sort_count(), 1);
+    ASSERT_TRUE(all_ops_have_same_info(f));
+}
+
 namespace bs_utils {
 static std::shared_ptr<ov::Model> create_n_inputs(ov::element::Type type,
                                                   const std::vector<ov::PartialShape>& shapes,
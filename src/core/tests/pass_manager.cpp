@@ -12,6 +12,11 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/pass/profiler.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +47,88 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+class RemoveRelu : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("RemoveRelu");
+    RemoveRelu() {
+        auto relu = ov::pass::pattern::wrap_type<ov::op::v0::Relu>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "RemoveRelu"),
+                         [](ov::pass::pattern::Matcher& m) {
+                             const auto relu = m.get_match_root();
+                             relu->output(0).replace(relu->input_value(0));
+                             return true;
+                         });
+    }
+};
+
+class NestedManagerPass : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("NestedManagerPass");
+    NestedManagerPass() {
+        set_name("NestedManagerPass");
+    }
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        ov::pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<RemoveRelu>();
+        manager.run_passes(model);
+        return true;
+    }
+};
+
+std::shared_ptr<ov::Model> make_relu_chain(size_t length) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 8});
+    ov::Output<ov::Node> out = param;
+    for (size_t i = 0; i < length; i++)
+        out = std::make_shared<ov::op::v0::Relu>(out);
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{param});
+    model->set_friendly_name("relu_chain");
+    return model;
+}
+}  // namespace
+
+TEST(pass_manager, profiler_records_passes) {
+    auto model = make_relu_chain(5);
+    auto profiler = std::make_shared<ov::pass::PassProfiler>();
+    {
+        ov::pass::PassProfiler::Scope scope(profiler);
+        ov::pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<NestedManagerPass>();
+        manager.run_passes(model);
+    }
+    EXPECT_EQ(ov::pass::PassProfiler::get_active(), nullptr);
+
+    const auto records = profiler->get_records();
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].name, "NestedManagerPass");
+    EXPECT_EQ(records[0].model, "relu_chain");
+    EXPECT_EQ(records[0].depth, 0u);
+    EXPECT_EQ(records[0].nodes_before, 7u);
+    EXPECT_EQ(records[0].nodes_after, 2u);
+    EXPECT_EQ(records[0].matcher_hits, 0u);
+    EXPECT_TRUE(records[0].changed);
+    EXPECT_GE(records[0].duration_us, records[1].duration_us);
+
+    EXPECT_EQ(records[1].name, "RemoveRelu");
+    EXPECT_EQ(records[1].depth, 1u);
+    EXPECT_EQ(records[1].nodes_before, 7u);
+    EXPECT_EQ(records[1].nodes_after, 2u);
+    EXPECT_EQ(records[1].matcher_hits, 5u);
+    EXPECT_TRUE(records[1].changed);
+    EXPECT_GE(records[1].start_us, records[0].start_us);
+
+    // the passes run without the active scope are not recorded
+    ov::pass::Manager manager;
+    manager.register_pass<RemoveRelu>();
+    manager.run_passes(make_relu_chain(2));
+    EXPECT_EQ(profiler->get_records().size(), 2u);
+
+    std::stringstream trace;
+    profiler->dump_chrome_trace(trace);
+    EXPECT_NE(trace.str().find("\"name\":\"RemoveRelu\""), std::string::npos);
+    EXPECT_NE(trace.str().find("\"matcher_hits\":5"), std::string::npos);
+}
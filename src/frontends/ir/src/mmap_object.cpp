@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_object.hpp"
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov {
+namespace {
+std::shared_ptr<ngraph::runtime::AlignedBuffer> make_shared_buffer(
+    const std::shared_ptr<ov::util::MappedMemory>& mapped_memory) {
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data(),
+        mapped_memory->size(),
+        mapped_memory);
+}
+}  // namespace
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+    return make_shared_buffer(ov::util::load_mmap_object(path));
+}
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
+    return make_shared_buffer(ov::util::load_mmap_object(path));
+}
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
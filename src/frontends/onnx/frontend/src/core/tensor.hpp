@@ -7,6 +7,8 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -77,9 +79,10 @@ bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
            tensor.data_location() == ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
 }
 
-inline std::string load_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
+inline std::shared_ptr<MappedMemoryBuffer> load_external_data(const ONNX_NAMESPACE::TensorProto& tensor,
+                                                              const MappedMemoryHandles& cache = nullptr) {
     const auto tensor_external_data = TensorExternalData(tensor);
-    return tensor_external_data.load_external_data();
+    return tensor_external_data.load_external_data(cache);
 }
 
 template <typename T>
@@ -90,7 +93,11 @@ inline std::vector<T> __get_raw_data(const std::string& raw_data, int onnx_data_
 
 template <typename T>
 inline std::vector<T> get_external_data(const ONNX_NAMESPACE::TensorProto& tensor) {
-    return __get_raw_data<T>(load_external_data(tensor), tensor.data_type());
+    const auto external_data = load_external_data(tensor);
+    // the mapped data is not necessarily aligned to the element type
+    std::vector<T> data(external_data->size() / onnx_common::get_onnx_data_size(tensor.data_type()));
+    std::memcpy(data.data(), external_data->get_ptr(), data.size() * sizeof(T));
+    return data;
 }
 
 inline const void* get_data_ptr(const ONNX_NAMESPACE::TensorProto& tensor) {
@@ -355,9 +362,10 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
-          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())} {
+          m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -443,6 +451,9 @@ public:
         if (m_tensor_proto->has_segment()) {
             throw error::tensor::segments_unsupported{};
         }
+        if (detail::has_tensor_external_data(*m_tensor_proto)) {
+            return make_ng_constant_from_external_data(get_ng_type());
+        }
         switch (m_tensor_proto->data_type()) {
         case ONNX_NAMESPACE::TensorProto_DataType::TensorProto_DataType_BOOL:
             return make_ng_constant<char>(element::boolean);
@@ -476,6 +487,25 @@ public:
     }
 
 private:
+    /// \brief Creates the Constant which refers to the memory mapped external data file instead of a copy
+    ///        of the data. The data is copied only if it is not aligned to the element type in the file.
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_external_data(const element::Type& type) const {
+        const auto external_data = detail::load_external_data(*m_tensor_proto, m_mmap_cache);
+        if (external_data->size() < shape_size(m_shape) * type.size()) {
+            throw error::tensor::shape_doesnt_match_data_size{};
+        }
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        if (reinterpret_cast<std::uintptr_t>(external_data->get_ptr()) % type.size() == 0) {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+        } else {
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data->get_ptr());
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     template <typename T,
               typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value ||
                                           std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
@@ -484,10 +514,7 @@ private:
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         int data_size = detail::get_data_size(*m_tensor_proto);
-        if (detail::has_tensor_external_data(*m_tensor_proto)) {
-            auto external_data = detail::load_external_data(*m_tensor_proto);
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, detail::get_data_ptr(*m_tensor_proto));
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -525,6 +552,7 @@ private:
 
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
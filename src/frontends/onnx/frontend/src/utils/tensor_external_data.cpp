@@ -4,8 +4,8 @@
 
 #include "utils/tensor_external_data.hpp"
 
-#include <fstream>
 #include <sstream>
+#include <stdexcept>
 
 #include "exceptions.hpp"
 #include "ngraph/file_util.hpp"
@@ -20,51 +20,54 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
         if (entry.key() == "location")
             m_data_location = entry.value();
         if (entry.key() == "offset")
-            m_offset = std::stoi(entry.value());
+            m_offset = std::stoull(entry.value());
         if (entry.key() == "length")
-            m_data_length = std::stoi(entry.value());
+            m_data_length = std::stoull(entry.value());
         if (entry.key() == "checksum")
             m_sha1_digest = std::stoi(entry.value());
     }
 }
 
-std::string TensorExternalData::load_external_data() const {
-    NGRAPH_SUPPRESS_DEPRECATED_START
+std::shared_ptr<MappedMemoryBuffer> TensorExternalData::load_external_data(const MappedMemoryHandles& cache) const {
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    if (cache) {
+        const auto it = cache->find(m_data_location);
+        if (it != cache->end()) {
+            mapped_memory = it->second;
+        }
+    }
+    if (!mapped_memory) {
+        NGRAPH_SUPPRESS_DEPRECATED_START
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    std::wstring path = ov::util::string_to_wstring(m_data_location);
+        std::wstring path = ov::util::string_to_wstring(m_data_location);
 #else
-    std::string path = m_data_location;
+        std::string path = m_data_location;
 #endif
-    NGRAPH_SUPPRESS_DEPRECATED_END
-    std::ifstream external_data_stream(path, std::ios::binary | std::ios::in | std::ios::ate);
-    if (external_data_stream.fail())
-        throw error::invalid_external_data{*this};
+        NGRAPH_SUPPRESS_DEPRECATED_END
+        try {
+            mapped_memory = ov::util::load_mmap_object(path);
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        if (cache) {
+            cache->emplace(m_data_location, mapped_memory);
+        }
+    }
 
-    std::streamsize read_data_length;
-    if (m_data_length == 0)  // read entire file
-        read_data_length = external_data_stream.tellg();
-    else
-        read_data_length = m_data_length;
+    const uint64_t file_size = mapped_memory->size();
+    if (m_offset > file_size || m_data_length > file_size - m_offset)
+        throw error::invalid_external_data{*this};
 
-    const auto page_size = 4096;
-    if (m_offset != 0 && m_offset % page_size != 0) {
-        NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                       "support, current value is "
-                    << m_offset;
-    }
-    // default value of m_offset is 0
-    external_data_stream.seekg(m_offset, std::ios::beg);
+    // read the file from the offset to the end if the length is not set
+    const auto data_length = m_data_length == 0 ? file_size - m_offset : m_data_length;
 
     if (m_sha1_digest != 0) {
         NGRAPH_WARN << "SHA1 checksum is not supported";
     }
 
-    std::string read_data;
-    read_data.resize(read_data_length);
-    external_data_stream.read(&read_data[0], read_data_length);
-    external_data_stream.close();
-
-    return read_data;
+    return std::make_shared<MappedMemoryBuffer>(mapped_memory->data() + m_offset,
+                                                static_cast<size_t>(data_length),
+                                                mapped_memory);
 }
 
 std::string TensorExternalData::to_string() const {
@@ -6,9 +6,23 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Files mapped to the memory by the tensors of a model, the key is the path to the file
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
+/// \brief  View to the data of a tensor which keeps the file mapped
+using MappedMemoryBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -16,12 +30,16 @@ public:
 
     /// \brief      Load external data from tensor passed to constructor
     ///
-    /// \note       If read data from external file fails,
+    /// \note       The data is not copied, the file is mapped to the memory and
+    ///             its pages are read when they are accessed for the first time.
     /// \note       If reading data from external files fails,
     ///             the invalid_external_data exception is thrown.
     ///
-    /// \return     External binary data loaded into a std::string
-    std::string load_external_data() const;
+    /// \param      cache  The files already mapped for the other tensors of the model.
+    ///                    If it is nullptr the file is mapped for this tensor only.
+    ///
+    /// \return     External binary data as a view into the mapped file
+    std::shared_ptr<MappedMemoryBuffer> load_external_data(const MappedMemoryHandles& cache = nullptr) const;
 
     /// \brief      Represets parameter of external data as string
     ///
@@ -30,8 +48,8 @@ public:
 
 private:
     std::string m_data_location{};
-    int m_offset = 0;
-    int m_data_length = 0;
+    uint64_t m_offset = 0;
+    uint64_t m_data_length = 0;
     int m_sha1_digest = 0;
 };
 }  // namespace detail
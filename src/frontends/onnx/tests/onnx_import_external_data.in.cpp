@@ -93,6 +93,27 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_constants_share_mapped_file) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, std::shared_ptr<default_opset::Constant>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(1, constants.count("data_a"));
+    ASSERT_EQ(1, constants.count("data_b"));
+    // the constants are views into the single mapping of the file, data_b is stored with offset 4096
+    const auto data_a = constants["data_a"]->get_data_ptr<char>();
+    const auto data_b = constants["data_b"]->get_data_ptr<char>();
+    EXPECT_EQ(4096, data_b - data_a);
+    EXPECT_EQ((std::vector<int32_t>{1, 2, 3}), constants["data_b"]->cast_vector<int32_t>());
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -45,6 +45,36 @@ void extract_tensor_content(const std::string& tensor_content, ov::Tensor* value
     std::copy(tensor_values, tensor_values + tensor_content_size / sizeof(T), values->data<T>());
 }
 
+// Gives out the memory of tensor_content instead of allocating it, the content is kept alive by the owner
+class TensorContentAllocator : public ov::AllocatorImpl {
+public:
+    TensorContentAllocator(const std::string& content, std::shared_ptr<const void> owner)
+        : m_content(content),
+          m_owner(std::move(owner)) {}
+
+    void* allocate(const size_t bytes, const size_t) override {
+        FRONT_END_GENERAL_CHECK(bytes == m_content.size(), "Size of tensor is not equal to tensor_content size.");
+        return const_cast<char*>(m_content.data());
+    }
+
+    void deallocate(void*, const size_t, size_t) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    const std::string& m_content;
+    std::shared_ptr<const void> m_owner;
+};
+
+bool can_share_tensor_content(const std::string& tensor_content,
+                              const ov::element::Type& type,
+                              const ov::Shape& shape) {
+    return tensor_content.size() == ov::shape_size(shape) * type.size() &&
+           reinterpret_cast<uintptr_t>(tensor_content.data()) % type.size() == 0;
+}
+
 template <typename T>
 void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_proto,
                                        int64_t val_size,
@@ -86,23 +116,23 @@ void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_p
 }  // namespace
 
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
+    const auto attr = decode_attribute_helper(name);
+    if (!attr) {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attr->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
         std::vector<ov::Dimension> dims;
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr->shape();
         for (int i = 0; i < tf_shape.dim_size(); i++) {
             dims.emplace_back(tf_shape.dim(i).size());
         }
@@ -110,8 +140,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attr->type())) {
+            return TYPE_MAP().at(attr->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -119,7 +149,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -163,7 +193,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attr->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -175,8 +205,15 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
+        const auto& tensor_content = tensor_proto.tensor_content();
+        if (m_graph_def && !tensor_content.empty() && tensor_proto.has_tensor_shape() &&
+            can_share_tensor_content(tensor_content, ov_type, pshape.get_shape())) {
+            // the tensor points to the content inside of GraphDef, so the Constant created from it does not copy
+            return ov::Tensor(ov_type,
+                              pshape.get_shape(),
+                              ov::Allocator(std::make_shared<TensorContentAllocator>(tensor_content, m_graph_def)));
+        }
         ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
         if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
@@ -284,14 +321,10 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
-    } else {
-        return {};
-    }
+const ::tensorflow::AttrValue* DecoderProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    const auto it = attr_map.find(name);
+    return it != attr_map.end() ? &it->second : nullptr;
 }
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,8 +4,8 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
-#include <vector>
 
 #include "openvino/frontend/tensorflow/decoder.hpp"
 
@@ -20,7 +20,12 @@ namespace tensorflow {
 
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
-    explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
+    /// \param node_def Node of the parsed graph
+    /// \param graph_def Owner of node_def. If it is given, the values of Const tensors are not copied and
+    /// the tensors returned by get_attribute keep it alive
+    explicit DecoderProto(const ::tensorflow::NodeDef* node_def, std::shared_ptr<const void> graph_def = nullptr)
+        : m_node_def(node_def),
+          m_graph_def(std::move(graph_def)) {}
 
     ov::Any get_attribute(const std::string& name) const override;
 
@@ -35,8 +40,9 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    const ::tensorflow::AttrValue* decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<const void> m_graph_def;
 };
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,8 +4,10 @@
 
 #include "openvino/frontend/tensorflow/frontend.hpp"
 
+#include "decoder_proto.hpp"
 #include "graph_iterator_proto.hpp"
 #include "helper_transforms/embedding_segments_feature_fusing.hpp"
+#include "ie_parallel.hpp"
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/frontend/tensorflow/extension/conversion.hpp"
@@ -99,8 +101,42 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         ng_op_map[input_name] = {param};
     }
 
+    // Const operations have no inputs, so they are translated in parallel before the rest of the graph.
+    // Only the operations decoded by DecoderProto with the built-in translator are taken: user decoders and
+    // conversion extensions are not required to be thread-safe. The failed ones are translated again below
+    // to report the error or to create FrameworkNode
+    std::vector<ov::OutputVector> const_outputs(operation_places.size());
+    const auto const_translator = translate_map.find("Const");
+    const bool const_extension = std::any_of(m_conversion_extensions.begin(),
+                                             m_conversion_extensions.end(),
+                                             [](const ConversionExtensionBase::Ptr& extension) {
+                                                 return extension->get_op_type() == "Const";
+                                             });
+    if (const_translator != translate_map.end() && !const_extension) {
+        std::vector<size_t> const_places;
+        for (size_t place_idx = 0; place_idx < operation_places.size(); ++place_idx) {
+            const auto& operation_decoder = operation_places[place_idx]->get_decoder();
+            if (operation_decoder->get_op_type() == "Const" &&
+                std::dynamic_pointer_cast<DecoderProto>(operation_decoder) &&
+                ng_op_map.count(operation_places[place_idx]->get_names()[0]) == 0) {
+                const_places.push_back(place_idx);
+            }
+        }
+        InferenceEngine::parallel_for(const_places.size(), [&](size_t idx) {
+            const auto place_idx = const_places[idx];
+            try {
+                const ov::OutputVector no_inputs;
+                NodeContext node_context(operation_places[place_idx]->get_decoder(), no_inputs);
+                const_outputs[place_idx] = const_translator->second(node_context);
+            } catch (...) {
+                // the operation stays untranslated and the error is handled in the sequential pass
+            }
+        });
+    }
+
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
+    for (size_t place_idx = 0; place_idx < operation_places.size(); ++place_idx) {
+        const auto& operation_place = operation_places[place_idx];
         auto operation_decoder = operation_place->get_decoder();
         auto operation_name = operation_place->get_names()[0];
         // output for parameter nodes has been already generated
@@ -163,26 +199,28 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         }
 
         // generate OV node output vector for the current operation node
-        ov::OutputVector ng_outputs;
-        try {
-            FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
-                                          "No translator found for " + operation_decoder->get_op_type() + " node.");
-            auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
-            // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
-            // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
-            NodeContext node_context(operation_decoder, ng_inputs);
-            // generate OV node output vector using translator for given operation type
-            ng_outputs = (*op_fun)(node_context);
-        } catch (...) {
-            if (fail_fast) {
-                // re-throw any exception
-                throw;
-            } else {
-                auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
-                                                               ng_inputs,
-                                                               operation_place->get_output_ports().size());
-                set_node_name(operation_name, ng_node);
-                ng_outputs = ng_node->outputs();
+        ov::OutputVector ng_outputs = std::move(const_outputs[place_idx]);
+        if (ng_outputs.empty()) {
+            try {
+                FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
+                                              "No translator found for " + operation_decoder->get_op_type() + " node.");
+                auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
+                // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
+                // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
+                NodeContext node_context(operation_decoder, ng_inputs);
+                // generate OV node output vector using translator for given operation type
+                ng_outputs = (*op_fun)(node_context);
+            } catch (...) {
+                if (fail_fast) {
+                    // re-throw any exception
+                    throw;
+                } else {
+                    auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
+                                                                   ng_inputs,
+                                                                   operation_place->get_output_ports().size());
+                    set_node_name(operation_name, ng_node);
+                    ng_outputs = ng_node->outputs();
+                }
             }
         }
 
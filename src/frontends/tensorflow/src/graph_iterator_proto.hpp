@@ -4,7 +4,7 @@
 
 #pragma once
 
-#include <fstream>
+#include <limits>
 
 #include "decoder_proto.hpp"
 #include "graph.pb.h"
@@ -12,6 +12,7 @@
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/tensorflow/decoder.hpp"
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace frontend {
@@ -25,10 +26,17 @@ class GraphIteratorProto : public GraphIterator {
 public:
     template <typename T>
     GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(std::make_shared<::tensorflow::GraphDef>()) {
-        std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
-
-        FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
-        FRONT_END_GENERAL_CHECK(m_graph_def->ParseFromIstream(&pb_stream), "Model cannot be parsed");
+        // the model is parsed directly from the mapped file, the mapping is released once GraphDef is built
+        std::shared_ptr<ov::util::MappedMemory> mapped_model;
+        try {
+            mapped_model = ov::util::load_mmap_object(path);
+        } catch (const std::runtime_error&) {
+            FRONT_END_GENERAL_CHECK(false, "Model file does not exist");
+        }
+        FRONT_END_GENERAL_CHECK(mapped_model->size() <= static_cast<size_t>(std::numeric_limits<int>::max()) &&
+                                    m_graph_def->ParseFromArray(mapped_model->data(),
+                                                                static_cast<int>(mapped_model->size())),
+                                "Model cannot be parsed");
 
         m_nodes.resize(m_graph_def->node_size());
         for (size_t i = 0; i < m_nodes.size(); ++i)
@@ -55,7 +63,7 @@ public:
 
     /// Return NodeContext for the current node that iterator points to
     std::shared_ptr<DecoderBase> get_decoder() const override {
-        return std::make_shared<DecoderProto>(m_nodes[node_index]);
+        return std::make_shared<DecoderProto>(m_nodes[node_index], m_graph_def);
     }
 };
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "decoder_proto.hpp"
 #include "op_table.hpp"
 #include "openvino/opsets/opset8.hpp"
 
@@ -15,7 +16,16 @@ namespace op {
 
 OutputVector translate_const_op(const NodeContext& node) {
     auto tensor = node.get_attribute<ov::Tensor>("value");
-    auto res = std::make_shared<ov::opset8::Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+    std::shared_ptr<Constant> res;
+    if (std::dynamic_pointer_cast<DecoderProto>(node.get_decoder())) {
+        // DecoderProto gives out the tensors which own their memory, so Constant can share it
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<ov::Tensor>>(static_cast<char*>(tensor.data()),
+                                                                                  tensor.get_byte_size(),
+                                                                                  tensor);
+        res = std::make_shared<Constant>(tensor.get_element_type(), tensor.get_shape(), buffer);
+    } else {
+        res = std::make_shared<Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+    }
     set_node_name(node.get_name(), res);
     return {res};
 }
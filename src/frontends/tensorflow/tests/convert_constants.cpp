@@ -0,0 +1,53 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace ov::frontend;
+
+TEST(FrontEndConvertModelTest, test_constants_values) {
+    std::shared_ptr<ov::Model> model;
+    {
+        FrontEndManager fem;
+        FrontEnd::Ptr frontEnd;
+        InputModel::Ptr inputModel;
+        ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+        ASSERT_NE(frontEnd, nullptr);
+        auto model_filename = FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                                 std::string("constants/constants.pb"));
+        ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+        ASSERT_NE(inputModel, nullptr);
+        ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+        ASSERT_NE(model, nullptr);
+    }
+
+    // the constants share the memory with the parsed model, so it must outlive the frontend and the input model
+    std::map<std::string, std::shared_ptr<ov::opset8::Constant>> constants;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (const auto& constant = ov::as_type_ptr<ov::opset8::Constant>(node)) {
+            constants[constant->get_friendly_name()] = constant;
+        }
+    }
+    ASSERT_EQ(constants.count("const_f32"), 1);
+    EXPECT_EQ(constants["const_f32"]->get_element_type(), ov::element::f32);
+    EXPECT_EQ(constants["const_f32"]->get_shape(), (ov::Shape{2, 3}));
+    EXPECT_EQ(constants["const_f32"]->cast_vector<float>(), (std::vector<float>{0, 1, 2, 3, 4, 5}));
+
+    ASSERT_EQ(constants.count("const_i64"), 1);
+    EXPECT_EQ(constants["const_i64"]->get_element_type(), ov::element::i64);
+    EXPECT_EQ(constants["const_i64"]->cast_vector<int64_t>(), (std::vector<int64_t>{3, -2, 1}));
+
+    ASSERT_EQ(constants.count("const_u8"), 1);
+    EXPECT_EQ(constants["const_u8"]->get_element_type(), ov::element::u8);
+    EXPECT_EQ(constants["const_u8"]->get_shape(), (ov::Shape{1, 3}));
+    EXPECT_EQ(constants["const_u8"]->cast_vector<uint8_t>(), (std::vector<uint8_t>{7, 8, 9}));
+
+    ASSERT_EQ(constants.count("const_scalar"), 1);
+    EXPECT_EQ(constants["const_scalar"]->cast_vector<float>(), (std::vector<float>{2}));
+}
@@ -0,0 +1,40 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+#
+# constants tensorflow model generator
+#
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+
+def main():
+    tf.compat.v1.reset_default_graph()
+
+    # Create the graph and model
+    with tf.compat.v1.Session() as sess:
+        input = tf.compat.v1.placeholder(tf.float32, [2, 3], 'x')
+
+        # multi-element constants are serialized into tensor_content
+        const_f32 = tf.constant(np.arange(6, dtype=np.float32).reshape([2, 3]), name="const_f32")
+        const_i64 = tf.constant(np.array([3, -2, 1], dtype=np.int64), name="const_i64")
+        const_u8 = tf.constant(np.array([[7, 8, 9]], dtype=np.uint8), name="const_u8")
+        # scalar constants are serialized into the typed value fields
+        const_scalar = tf.constant(2.0, dtype=tf.float32, name="const_scalar")
+
+        add = tf.add(input, const_f32, name="add")
+        mul = tf.multiply(add, const_scalar, name="mul")
+        tf.add(mul, tf.cast(const_u8, tf.float32), name="add_u8")
+        tf.cast(const_i64, tf.float32, name="cast_i64")
+
+        tf.compat.v1.global_variables_initializer()
+        tf_net = sess.graph_def
+
+    tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "constants"), "constants.pb", False)
+
+
+if __name__ == "__main__":
+    main()
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <exception>
 #include <future>
 #include <map>
@@ -15,6 +19,7 @@
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "threading/ie_immediate_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
@@ -39,8 +44,6 @@ namespace InferenceEngine {
  */
 class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
     enum InferState { Idle, Busy, Cancelled, Stop };
-    using Futures = std::vector<std::shared_future<void>>;
-    using Promise = std::shared_ptr<std::promise<void>>;
     enum Stage_e : std::uint8_t { executor, task };
     IInferRequestInternal::Ptr _syncRequest;
 
@@ -52,7 +55,7 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
         }
         ~DisableCallbackGuard() {
             std::lock_guard<std::mutex> lock{_this->_mutex};
-            _this->_callback = _callback;
+            _this->_callback = std::move(_callback);
         }
         AsyncInferRequestThreadSafeDefault* _this = nullptr;
         Callback _callback;
@@ -67,6 +70,116 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
         IStreamsExecutor::Ptr _streamsExecutor;
     };
 
+    /**
+     * @brief Completion of the inferences started by the request. Unlike std::promise it is created once and reused
+     *        by every inference, the waiting threads are notified only if there are any.
+     */
+    class Completion {
+    public:
+        /**
+         * @brief Registers the started inference
+         * @return Id of the inference, which is passed to Complete()
+         */
+        std::uint64_t Start() {
+            std::lock_guard<std::mutex> lock{_mutex};
+            ++_running;
+            return ++_started;
+        }
+
+        /**
+         * @brief Stores the result of the inference and wakes up the waiting threads
+         * @param id Id returned by Start()
+         * @param exception Exception raised by the inference or nullptr
+         */
+        void Complete(std::uint64_t id, std::exception_ptr exception) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            --_running;
+            // the callback can start the next inference, which may complete earlier than the previous one
+            if (id > _completed.load(std::memory_order_relaxed)) {
+                _exception = std::move(exception);
+                _completed.store(id, std::memory_order_release);
+            }
+            if (_waiters != 0) {
+                _condVar.notify_all();
+            }
+        }
+
+        /**
+         * @brief Returns id of the last started inference or zero if nothing was started
+         */
+        std::uint64_t LastStarted() const {
+            std::lock_guard<std::mutex> lock{_mutex};
+            return _started;
+        }
+
+        /**
+         * @brief Checks without blocking that the inference is completed
+         */
+        bool IsCompleted(std::uint64_t id) const {
+            return _completed.load(std::memory_order_acquire) >= id;
+        }
+
+        /**
+         * @brief Waits for completion of the inference
+         * @param id Id of the inference
+         * @param millis_timeout Timeout in milliseconds or InferRequest::WaitMode::RESULT_READY to wait infinitely
+         * @return `true` if the inference is completed
+         */
+        bool Wait(std::uint64_t id, int64_t millis_timeout) {
+            if (IsCompleted(id)) {
+                return true;
+            }
+            std::unique_lock<std::mutex> lock{_mutex};
+            ++_waiters;
+            auto isCompleted = [&] {
+                return IsCompleted(id);
+            };
+            bool completed = true;
+            if (InferRequest::WaitMode::RESULT_READY == millis_timeout) {
+                _condVar.wait(lock, isCompleted);
+            } else {
+                completed = _condVar.wait_for(lock, std::chrono::milliseconds{millis_timeout}, isCompleted);
+            }
+            --_waiters;
+            return completed;
+        }
+
+        /**
+         * @brief Waits until all the started inferences are completed
+         */
+        void WaitAll() {
+            std::unique_lock<std::mutex> lock{_mutex};
+            ++_waiters;
+            _condVar.wait(lock, [&] {
+                return 0 == _running;
+            });
+            --_waiters;
+        }
+
+        /**
+         * @brief Rethrows the exception raised by the last completed inference
+         */
+        void Get() const {
+            std::exception_ptr exception;
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                exception = _exception;
+            }
+            if (nullptr != exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+    private:
+        mutable std::mutex _mutex;
+        std::condition_variable _condVar;
+        std::uint64_t _started = 0;
+        std::atomic<std::uint64_t> _completed{0};
+        std::size_t _running = 0;
+        std::size_t _waiters = 0;
+        std::exception_ptr _exception;
+    };
+
     template <typename F>
     void InferImpl(const F& f) {
         _syncRequest->checkBlobs();
@@ -79,33 +192,24 @@ class AsyncInferRequestThreadSafeDefault : public IInferRequestInternal {
                 IE_THROW(RequestBusy);
             case InferState::Cancelled:
                 IE_THROW(InferCancelled);
-            case InferState::Idle: {
-                _futures.erase(std::remove_if(std::begin(_futures),
-                                              std::end(_futures),
-                                              [](const std::shared_future<void>& future) {
-                                                  if (future.valid()) {
-                                                      return (std::future_status::ready ==
-                                                              future.wait_for(std::chrono::milliseconds{0}));
-                                                  } else {
-                                                      return true;
-                                                  }
-                                              }),
-                               _futures.end());
-                _promise = {};
-                _futures.emplace_back(_promise.get_future().share());
-            } break;
+            case InferState::Idle:
+                _run.id = _completion.Start();
+                break;
             case InferState::Stop:
                 break;
             }
             _state = InferState::Busy;
         }
         if (state != InferState::Stop) {
+            const auto runId = _run.id;
             try {
                 f();
             } catch (...) {
-                _promise.set_exception(std::current_exception());
-                std::lock_guard<std::mutex> lock{_mutex};
-                _state = InferState::Idle;
+                {
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _state = InferState::Idle;
+                }
+                _completion.Complete(runId, std::current_exception());
                 throw;
             }
         }
@@ -153,9 +257,26 @@ public:
                      [this] {
                          _syncRequest->InferImpl();
                      }}},
-          _syncPipeline{{std::make_shared<ImmediateExecutor>(), [this] {
+          _syncPipeline{{std::make_shared<ImmediateExecutor>(),
+                         [this] {
                              _syncRequest->InferImpl();
-                         }}} {
+                         }}},
+          _stageTask{[this] {
+              RunCurrentStage();
+          }},
+          _lastStageTask{[this] {
+              RunLastStage();
+          }} {
+        // the hints are reused by every inference, so the task is not created on each start
+        _schedulingHints.onDeadlineMissed = [this] {
+            std::exception_ptr deadlineMissed;
+            try {
+                IE_THROW(InferCancelled) << "The infer request has missed the deadline";
+            } catch (...) {
+                deadlineMissed = std::current_exception();
+            }
+            FinishPipeline(deadlineMissed);
+        };
         auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(taskExecutor);
         if (streamsExecutor != nullptr) {
             _syncPipeline = {{std::make_shared<ImmediateStreamsExecutor>(std::move(streamsExecutor)), [this] {
@@ -182,33 +303,17 @@ public:
             IE_THROW(ParameterMismatch) << " Timeout can't be less " << InferRequest::WaitMode::RESULT_READY
                                         << " for InferRequest::Wait\n";
         }
-        auto status = std::future_status::deferred;
-
-        // Just use the last '_futures' member to wait pipeline completion
-        auto future = [&] {
-            std::lock_guard<std::mutex> lock{_mutex};
-            return _futures.empty() ? std::shared_future<void>{} : _futures.back();
-        }();
-
-        if (!future.valid()) {
+        // Just wait for the last started pipeline
+        const auto runId = _completion.LastStarted();
+        if (0 == runId) {
             return StatusCode::INFER_NOT_STARTED;
         }
 
-        switch (millis_timeout) {
-        case InferRequest::WaitMode::RESULT_READY: {
-            future.wait();
-            status = std::future_status::ready;
-        } break;
-        case InferRequest::WaitMode::STATUS_ONLY: {
-            status = future.wait_for(std::chrono::milliseconds{0});
-        } break;
-        default: {
-            status = future.wait_for(std::chrono::milliseconds{millis_timeout});
-        } break;
-        }
-
-        if (std::future_status::ready == status) {
-            future.get();
+        const bool completed = InferRequest::WaitMode::STATUS_ONLY == millis_timeout
+                                   ? _completion.IsCompleted(runId)
+                                   : _completion.Wait(runId, millis_timeout);
+        if (completed) {
+            _completion.Get();
             return StatusCode::OK;
         } else {
             return StatusCode::RESULT_NOT_READY;
@@ -217,6 +322,7 @@ public:
 
     void StartAsync() override {
         InferImpl([&] {
+            UpdateSchedulingHints();
             StartAsync_ThreadUnsafe();
         });
     }
@@ -224,6 +330,7 @@ public:
     void Infer() override {
         DisableCallbackGuard disableCallbackGuard{this};
         InferImpl([&] {
+            UpdateSchedulingHints();
             Infer_ThreadUnsafe();
         });
         Wait(InferRequest::WaitMode::RESULT_READY);
@@ -273,6 +380,29 @@ public:
         _callback = std::move(callback);
     }
 
+    /**
+     * @brief Sets ov::hint::request_priority and ov::hint::request_deadline, which are passed to the executors of
+     *        the pipeline stages
+     * @param properties Map of the property names and values
+     */
+    void SetProperty(const std::map<std::string, Parameter>& properties) override {
+        CheckState();
+        for (auto&& property : properties) {
+            if (property.first == ov::hint::request_priority.name()) {
+                _priority = static_cast<int>(property.second.as<ov::hint::Priority>());
+            } else if (property.first == ov::hint::request_deadline.name()) {
+                const auto deadline = property.second.as<int64_t>();
+                if (deadline < 0) {
+                    IE_THROW() << "Wrong value " << deadline << " for property key "
+                               << ov::hint::request_deadline.name() << ". Expected non-negative number";
+                }
+                _deadline = std::chrono::microseconds{deadline};
+            } else {
+                IE_THROW(NotFound) << "Unsupported infer request property " << property.first;
+            }
+        }
+    }
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override {
         CheckState();
         return _syncRequest->QueryState();
@@ -310,9 +440,8 @@ protected:
     using Pipeline = std::vector<Stage>;
 
     /**
-     * @brief Creates and run the first stage task. If destructor was not called add a new std::future to the
-     * AsyncInferRequestThreadSafeDefault::_futures list that would be used to wait
-     * AsyncInferRequestThreadSafeDefault::_pipeline finish
+     * @brief Creates and run the first stage task. The pipeline completion is reported to the waiting threads
+     * by the AsyncInferRequestThreadSafeDefault::_completion member
      * @param[in]  itBeginStage Iterator to begin of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Final or error stage executor
@@ -322,7 +451,10 @@ protected:
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
         IE_ASSERT(nullptr != firstStageExecutor);
-        firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+        _run.itStage = itBeginStage;
+        _run.itEndStage = itEndStage;
+        _run.callbackExecutor = std::move(callbackExecutor);
+        RunStage(firstStageExecutor);
     }
 
     /**
@@ -331,7 +463,6 @@ protected:
      * pipeline tasks
      */
     void StopAndWait() {
-        Futures futures;
         InferState state = InferState::Idle;
         {
             std::lock_guard<std::mutex> lock{_mutex};
@@ -339,15 +470,10 @@ protected:
             if (state != InferState::Stop) {
                 _callback = {};
                 _state = InferState::Stop;
-                futures = std::move(_futures);
             }
         }
         if (state != InferState::Stop) {
-            for (auto&& future : futures) {
-                if (future.valid()) {
-                    future.wait();
-                }
-            }
+            _completion.WaitAll();
         }
     }
 
@@ -382,79 +508,116 @@ protected:
 
 private:
     /**
-     * @brief Create a task with next pipeline stage.
-     * Each call to MakeNextStageTask() generates @ref Task objects for each stage.
-     * On last stage or if the exception is raised from `_pipeline` task
-     * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
-     * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
-     * one of `_futures` member
-     * @param[in]  itStage Iterator to next stage of pipeline
-     * @param[in]  itEndStage End pipeline iterator
-     * @param[in]  callbackExecutor Executor that will run final stage with callback call
-     * @return A next stage task
+     * @brief Computes the scheduling hints of the started inference from the request properties
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage,
-                           const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind(
-            [this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
-                std::exception_ptr currentException = nullptr;
-                auto& thisStage = *itStage;
-                auto itNextStage = itStage + 1;
-                try {
-                    auto& stageTask = std::get<Stage_e::task>(thisStage);
-                    IE_ASSERT(nullptr != stageTask);
-                    stageTask();
-                    if (itEndStage != itNextStage) {
-                        auto& nextStage = *itNextStage;
-                        auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
-                        IE_ASSERT(nullptr != nextStageExecutor);
-                        nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
-                    }
-                } catch (...) {
-                    currentException = std::current_exception();
-                }
+    void UpdateSchedulingHints() {
+        _schedulingHints.priority = _priority;
+        _schedulingHints.deadline = _deadline.count() > 0 ? std::chrono::steady_clock::now() + _deadline
+                                                          : std::chrono::steady_clock::time_point::max();
+    }
 
-                if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                    auto lastStageTask = [this, currentException]() mutable {
-                        auto promise = std::move(_promise);
-                        Callback callback;
-                        {
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            _state = InferState::Idle;
-                            std::swap(callback, _callback);
-                        }
-                        if (callback) {
-                            try {
-                                callback(currentException);
-                            } catch (...) {
-                                currentException = std::current_exception();
-                            }
-                            std::lock_guard<std::mutex> lock{_mutex};
-                            if (!_callback) {
-                                std::swap(callback, _callback);
-                            }
-                        }
-                        if (nullptr == currentException) {
-                            promise.set_value();
-                        } else {
-                            promise.set_exception(currentException);
-                        }
-                    };
-
-                    if (nullptr == callbackExecutor) {
-                        lastStageTask();
-                    } else {
-                        callbackExecutor->run(std::move(lastStageTask));
-                    }
-                }
-            },
-            std::move(callbackExecutor));
+    /**
+     * @brief State of the running pipeline. The request runs one pipeline at a time, so the state and the stage tasks
+     * are created once and reused by every inference.
+     */
+    struct PipelineRun {
+        Pipeline::iterator itStage;          //!< The stage to run
+        Pipeline::iterator itEndStage;       //!< End pipeline iterator
+        ITaskExecutor::Ptr callbackExecutor;  //!< Executor that will run final stage with callback call
+        std::exception_ptr exception;         //!< Exception raised from the pipeline
+        std::uint64_t id = 0;                 //!< Id of the inference in the AsyncInferRequestThreadSafeDefault::_completion
+    };
+
+    /**
+     * @brief Passes the current stage task to the executor. The stages of the request with the scheduling hints are
+     * run by ITaskExecutor::runScheduled, the request which has missed the deadline is completed as the cancelled one.
+     * @param[in]  executor Executor of the stage
+     */
+    void RunStage(const ITaskExecutor::Ptr& executor) {
+        if (_schedulingHints.priority == TaskSchedulingHints::defaultPriority && !_schedulingHints.hasDeadline()) {
+            executor->run(_stageTask);
+            return;
+        }
+        executor->runScheduled(_stageTask, _schedulingHints);
+    }
+
+    /**
+     * @brief Runs the current pipeline stage and passes the next one to its executor.
+     * On last stage or if the exception is raised from `_pipeline` task the pipeline is finished.
+     */
+    void RunCurrentStage() {
+        std::exception_ptr currentException = nullptr;
+        const auto itStage = _run.itStage;
+        const auto itEndStage = _run.itEndStage;
+        const auto itNextStage = itStage + 1;
+        try {
+            auto& stageTask = std::get<Stage_e::task>(*itStage);
+            IE_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (itEndStage != itNextStage) {
+                auto& nextStageExecutor = std::get<Stage_e::executor>(*itNextStage);
+                IE_ASSERT(nullptr != nextStageExecutor);
+                _run.itStage = itNextStage;
+                RunStage(nextStageExecutor);
+            }
+        } catch (...) {
+            currentException = std::current_exception();
+        }
+
+        if ((itEndStage == itNextStage) || (nullptr != currentException)) {
+            FinishPipeline(currentException);
+        }
+    }
+
+    /**
+     * @brief Runs the last stage task or passes it to the callback executor if it is presented
+     * @param[in]  currentException Exception raised from the pipeline or nullptr
+     */
+    void FinishPipeline(std::exception_ptr currentException) {
+        _run.exception = std::move(currentException);
+        if (nullptr == _run.callbackExecutor) {
+            RunLastStage();
+        } else {
+            _run.callbackExecutor->run(_lastStageTask);
+        }
+    }
+
+    /**
+     * @brief Calls the callback, if it is presented, and forwards completion or exception to the threads waiting
+     * for the pipeline using the `_completion` member
+     */
+    void RunLastStage() {
+        // the callback can start the next pipeline, which reuses the `_run` member
+        auto currentException = std::move(_run.exception);
+        const auto runId = _run.id;
+        Callback callback;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _state = InferState::Idle;
+            std::swap(callback, _callback);
+        }
+        if (callback) {
+            try {
+                callback(currentException);
+            } catch (...) {
+                currentException = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (!_callback) {
+                std::swap(callback, _callback);
+            }
+        }
+        _completion.Complete(runId, std::move(currentException));
     }
 
-    std::promise<void> _promise;
+    Completion _completion;
+    PipelineRun _run;
+    Task _stageTask;
+    Task _lastStageTask;
     mutable std::mutex _mutex;
-    Futures _futures;
     InferState _state = InferState::Idle;
+    int _priority = TaskSchedulingHints::defaultPriority;
+    std::chrono::microseconds _deadline{0};
+    TaskSchedulingHints _schedulingHints;
 };
 }  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 #include "ie_common.h"
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
+#include "ie_parameter.hpp"
 #include "ie_preprocess_data.hpp"
 #include "openvino/core/node_output.hpp"
 #include "so_ptr.hpp"
@@ -196,6 +197,13 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Sets the properties of the request, e.g. the scheduling hints ov::hint::request_priority and
+     *        ov::hint::request_deadline
+     * @param properties Map of the property names and values
+     */
+    virtual void SetProperty(const std::map<std::string, Parameter>& properties);
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -47,12 +47,25 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
 /**
- * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type per
- * stream
+ * @brief Defines how many records can be stored in the CPU runtime parameters cache per CPU runtime parameter type.
+ * The cache is shared by all the streams of a compiled model and by the compiled models with the same capacity
  * @ingroup ie_dev_api_plugin_api
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Makes the compiled model use its own CPU runtime parameters cache instead of the one shared with
+ * the other compiled models of the plugin (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_PER_NETWORK);
+
+/**
+ * @brief Enables concurrent execution of independent graph branches inside one CPU infer request (YES/NO)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -20,7 +20,11 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Every stream thread pulls tasks from its own queue and steals them from the queues of the other
+ *        streams, preferring the streams of the same NUMA node, when its queue is empty.
+ *        The tasks of the higher priority are started first. The tasks with the same priority and a deadline are
+ *        started in order of the deadline across all the streams, the ones without deadline follow in order of
+ *        submission to the stream queue, see InferenceEngine::TaskSchedulingHints.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -42,6 +46,8 @@ public:
 
     void run(Task task) override;
 
+    void runScheduled(Task task, const TaskSchedulingHints& hints) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
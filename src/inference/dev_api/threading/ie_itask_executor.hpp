@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +25,42 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief Scheduling hints of a task. The executors which do not order the tasks use only the deadline.
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskSchedulingHints {
+    /**
+     * @brief Default priority, the same as ov::hint::Priority::MEDIUM
+     */
+    static constexpr int defaultPriority = 1;
+
+    /**
+     * @brief The task with the higher priority is started first, the values are ov::hint::Priority ones
+     */
+    int priority = defaultPriority;
+
+    /**
+     * @brief The tasks with the same priority are started in order of the deadline, the ones without deadline
+     *        after them in order of submission
+     */
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    /**
+     * @brief Called instead of the task if the task is not started before the deadline.
+     *        The task is executed anyway if it is empty.
+     */
+    Task onDeadlineMissed;
+
+    /**
+     * @brief Checks that the deadline is set
+     * @return `true` if the deadline is set
+     */
+    bool hasDeadline() const {
+        return deadline != std::chrono::steady_clock::time_point::max();
+    }
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -74,6 +111,14 @@ public:
      * @param tasks A vector of tasks to execute
      */
     virtual void runAndWait(const std::vector<Task>& tasks);
+
+    /**
+     * @brief Execute InferenceEngine::Task with the scheduling hints. Default implementation ignores the priority
+     *        and checks the deadline just before the task is started.
+     * @param task A task to start
+     * @param hints The priority and the deadline of the task
+     */
+    virtual void runScheduled(Task task, const TaskSchedulingHints& hints);
 };
 
 }  // namespace InferenceEngine
@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -310,6 +311,25 @@ public:
      */
     void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets properties for the current inference request, e.g. ov::hint::request_priority or
+     * ov::hint::request_deadline.
+     * @note Not all plugins support the properties of the request.
+     * @param properties Map of pairs: (property name, property value).
+     */
+    void set_property(const AnyMap& properties);
+
+    /**
+     * @brief Sets properties for the current inference request.
+     *
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types.
+     * @param properties Optional pack of pairs: (property name, property value).
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<void, Properties...> set_property(Properties&&... properties) {
+        set_property(AnyMap{std::forward<Properties>(properties)...});
+    }
+
     /**
      * @brief Gets state control interface for the given infer request.
      *
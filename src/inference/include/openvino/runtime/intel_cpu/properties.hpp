@@ -47,5 +47,38 @@ namespace intel_cpu {
  */
 static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATION"};
 
+/**
+ * @brief Read-only property of the compiled model with the compile-time profile of the graph transformations.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The profile is collected when the model is compiled with ov::enable_profiling(true), otherwise the value is empty.
+ * It is a JSON document in the Chrome trace event format (chrome://tracing, Perfetto), every event is a single
+ * transformation pass run with its wall time, the number of the operations before and after the pass and the number
+ * of the successful pattern matches in the event arguments.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::enable_profiling(true));
+ * std::ofstream("transformations.json") << compiled_model.get_property(ov::intel_cpu::transformations_profile);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> transformations_profile{"CPU_TRANSFORMATIONS_PROFILE"};
+
+/**
+ * @brief Read-only property of the compiled model with the counters of the CPU runtime parameters cache.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The cache keeps the primitives and the JIT kernels compiled for the runtime parameters of the nodes. The value maps
+ * "HITS", "MISSES" and "EVICTIONS" to the number of the cache lookups of each kind since the cache was created.
+ * The cache is shared by the compiled models of one CPU plugin instance, so the counters include the lookups of
+ * the other compiled models that share it.
+ *
+ * @code
+ * auto stat = compiled_model.get_property(ov::intel_cpu::runtime_cache_statistics);
+ * std::cout << "runtime cache hits: " << stat["HITS"] << std::endl;
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -287,6 +287,22 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief High-level OpenVINO infer request priority hint
+ * The tasks of the request with the higher priority are started first by the device executor,
+ * set by ov::InferRequest::set_property
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<Priority> request_priority{"REQUEST_PRIORITY"};
+
+/**
+ * @brief Infer request deadline hint in microseconds counted from the start of the inference, 0 means no deadline
+ * The requests with the same priority are started in order of the deadline, the request which is not started before
+ * the deadline is not executed and completes with the ov::Cancelled exception. Set by ov::InferRequest::set_property
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<int64_t> request_deadline{"REQUEST_DEADLINE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -456,6 +472,28 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief Read-write property to set the upper bound of the models cache size in bytes
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When the cache directory grows beyond the limit, the least recently used cached blobs are removed.
+ * Zero value (default) means the cache size is not limited.
+ *
+ * @code
+ * ie.set_property(ov::cache_size_limit(1024 * 1024 * 1024)); // keep up to 1GB of cached blobs
+ * @endcode
+ */
+static constexpr Property<uint64_t> cache_size_limit{"CACHE_SIZE_LIMIT"};
+
+/**
+ * @brief Read-write property to set whether compiled blobs are written to the models cache on a background thread
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * If enabled, `compile_model` does not wait until the blob is written to disk. The blob is served from memory
+ * until the write is finished. Disabled by default.
+ */
+static constexpr Property<bool> cache_async_write{"CACHE_ASYNC_WRITE"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
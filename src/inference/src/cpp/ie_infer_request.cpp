@@ -493,6 +493,10 @@ void InferRequest::set_callback(std::function<void(std::exception_ptr)> callback
     OV_INFER_REQ_CALL_STATEMENT(_impl->SetCallback(std::move(callback));)
 }
 
+void InferRequest::set_property(const AnyMap& properties) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->SetProperty(properties);)
+}
+
 std::vector<VariableState> InferRequest::query_state() {
     std::vector<VariableState> variable_states;
     std::vector<std::shared_ptr<void>> soVec;
@@ -453,6 +453,10 @@ void IInferRequestInternal::SetCallback(Callback callback) {
     _callback = std::move(callback);
 }
 
+void IInferRequestInternal::SetProperty(const std::map<std::string, Parameter>&) {
+    IE_THROW(NotImplemented);
+}
+
 void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial) {
     for (auto& input : preprocessedBlobs) {
         // If there is a pre-process entry for an input then it must be pre-processed
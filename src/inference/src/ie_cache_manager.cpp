@@ -0,0 +1,400 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <streambuf>
+#include <vector>
+
+#include "openvino/util/file_util.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#    include <utime.h>
+#else
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <Windows.h>
+#    include <process.h>
+#    include <sys/utime.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief Read-only stream buffer over a contiguous memory region, no data is copied
+ */
+class MemoryStreamBuf : public std::streambuf {
+public:
+    MemoryStreamBuf(const char* data, size_t size) {
+        auto begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        char* base = nullptr;
+        switch (dir) {
+        case std::ios_base::beg:
+            base = eback();
+            break;
+        case std::ios_base::cur:
+            base = gptr();
+            break;
+        default:
+            base = egptr();
+            break;
+        }
+        char* pos = base + off;
+        if (pos < eback() || pos > egptr())
+            return pos_type(off_type(-1));
+        setg(eback(), pos, egptr());
+        return pos_type(off_type(pos - eback()));
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+/**
+ * @brief Write-only stream buffer which appends to a string owned by the caller, unlike std::ostringstream
+ * the result is taken without copying
+ */
+class StringStreamBuf : public std::streambuf {
+public:
+    explicit StringStreamBuf(std::string& data) : m_data(data) {}
+
+protected:
+    std::streamsize xsputn(const char* s, std::streamsize count) override {
+        m_data.append(s, static_cast<size_t>(count));
+        return count;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            m_data.push_back(traits_type::to_char_type(ch));
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    std::string& m_data;
+};
+
+/**
+ * @brief Read-only memory mapping of a whole file
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                m_data = static_cast<const char*>(data);
+                m_size = static_cast<size_t>(st.st_size);
+            }
+        }
+        m_valid = true;
+        close(fd);
+#else
+        HANDLE file = CreateFileA(path.c_str(),
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+        LARGE_INTEGER size;
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (m_mapping != nullptr) {
+                m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                if (m_data != nullptr)
+                    m_size = static_cast<size_t>(size.QuadPart);
+            }
+        }
+        m_valid = true;
+        CloseHandle(file);
+#endif
+    }
+
+    ~MappedFile() {
+#ifndef _WIN32
+        if (m_data)
+            munmap(const_cast<char*>(m_data), m_size);
+#else
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool valid() const {
+        return m_valid;
+    }
+    const char* data() const {
+        return m_data;
+    }
+    size_t size() const {
+        return m_size;
+    }
+
+private:
+    bool m_valid = false;
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
+bool fileStat(const std::string& path, uint64_t& size, int64_t& mtime) {
+#ifndef _WIN32
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+        return false;
+#else
+    struct _stat64 st;
+    if (_stat64(path.c_str(), &st) != 0)
+        return false;
+#endif
+    size = static_cast<uint64_t>(st.st_size);
+    mtime = static_cast<int64_t>(st.st_mtime);
+    return true;
+}
+
+void touchFile(const std::string& path) {
+#ifndef _WIN32
+    utime(path.c_str(), nullptr);
+#else
+    _utime(path.c_str(), nullptr);
+#endif
+}
+
+bool replaceFile(const std::string& from, const std::string& to) {
+#ifndef _WIN32
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#else
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#endif
+}
+
+std::string uniqueSuffix() {
+    static std::atomic<uint64_t> counter{0};
+#ifndef _WIN32
+    auto pid = getpid();
+#else
+    auto pid = _getpid();
+#endif
+    return "." + std::to_string(pid) + "." + std::to_string(counter++) + ".tmp";
+}
+
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit, bool asyncWrite)
+    : m_cachePath(std::move(cachePath)),
+      m_sizeLimit(sizeLimit),
+      m_asyncWrite(asyncWrite) {}
+
+FileStorageCacheManager::~FileStorageCacheManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if (m_writer.joinable())
+        m_writer.join();
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    if (!m_asyncWrite) {
+        // the entry is streamed straight to the file
+        storeBlob(id, writer);
+        return;
+    }
+
+    // the writer needs the network which is alive only during the call, so the entry is exported to memory
+    // and the buffer is handed over to the writer thread
+    std::string blob;
+    {
+        StringStreamBuf buf(blob);
+        std::ostream stream(&buf);
+        writer(stream);
+        if (!stream)
+            return;
+    }
+    auto data = std::make_shared<const std::string>(std::move(blob));
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending[id] = data;
+        m_queue.emplace_back(id, data);
+        if (!m_writer.joinable())
+            m_writer = std::thread(&FileStorageCacheManager::writerLoop, this);
+    }
+    m_cv.notify_one();
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    if (m_asyncWrite) {
+        Buffer pending;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_pending.find(id);
+            if (it != m_pending.end())
+                pending = it->second;
+        }
+        if (pending) {
+            MemoryStreamBuf buf(pending->data(), pending->size());
+            std::istream stream(&buf);
+            reader(stream);
+            return;
+        }
+    }
+
+    auto blobFileName = getBlobFile(id);
+    if (!FileUtils::fileExist(blobFileName))
+        return;
+
+    MappedFile file(blobFileName);
+    if (!file.valid())
+        return;
+    if (m_sizeLimit != 0)
+        touchFile(blobFileName);
+
+    MemoryStreamBuf buf(file.data(), file.size());
+    std::istream stream(&buf);
+    reader(stream);
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    if (m_asyncWrite) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.erase(id);
+        m_queue.erase(std::remove_if(m_queue.begin(),
+                                     m_queue.end(),
+                                     [&](const std::pair<std::string, Buffer>& entry) {
+                                         return entry.first == id;
+                                     }),
+                      m_queue.end());
+    }
+
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+void FileStorageCacheManager::storeBlob(const std::string& id, const StreamWriter& writer) {
+    auto blobFileName = getBlobFile(id);
+    auto tmpFileName = blobFileName + uniqueSuffix();
+    {
+        std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
+        stream.flush();
+        if (!stream) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            return;
+        }
+    }
+    if (!replaceFile(tmpFileName, blobFileName)) {
+        std::remove(tmpFileName.c_str());
+        return;
+    }
+
+    if (m_sizeLimit != 0)
+        evict(blobFileName);
+}
+
+void FileStorageCacheManager::evict(const std::string& keepFile) {
+    struct Entry {
+        std::string path;
+        uint64_t size;
+        int64_t mtime;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool is_dir) {
+        if (is_dir || ov::util::get_file_ext(file) != ".blob")
+            return;
+        Entry entry{file, 0, 0};
+        if (!fileStat(file, entry.size, entry.mtime))
+            return;
+        totalSize += entry.size;
+        if (file != keepFile)
+            entries.push_back(std::move(entry));
+    });
+    if (totalSize <= m_sizeLimit)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.mtime < b.mtime;
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_sizeLimit)
+            break;
+        // another process may have removed it already
+        std::remove(entry.path.c_str());
+        totalSize -= entry.size;
+    }
+}
+
+void FileStorageCacheManager::writerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [&] {
+            return m_stop || !m_queue.empty();
+        });
+        if (m_queue.empty())
+            break;
+
+        auto entry = std::move(m_queue.front());
+        m_queue.pop_front();
+        lock.unlock();
+        storeBlob(entry.first, [&](std::ostream& stream) {
+            stream.write(entry.second->data(), static_cast<std::streamsize>(entry.second->size()));
+        });
+        lock.lock();
+
+        // the entry is served from memory until it is on disk, unless it was overwritten or removed meanwhile
+        auto it = m_pending.find(entry.first);
+        if (it == m_pending.end()) {
+            std::remove(getBlobFile(entry.first).c_str());
+        } else if (it->second == entry.second) {
+            m_pending.erase(it);
+        }
+    }
+}
+
+}  // namespace InferenceEngine
@@ -9,10 +9,15 @@
  */
 #pragma once
 
-#include <fstream>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "file_utils.h"
 #include "ie_api.h"
@@ -75,48 +80,56 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
- *
+ * Every cache entry is a separate file in the cache directory:
+ *  - entries are written to a temporary file first and atomically renamed, so concurrent processes sharing
+ *    the cache directory never observe partially written blobs
+ *  - entries are read through a memory mapping of the file
+ *  - optionally, entries are written on a background thread; until the write is finished, the entry is served
+ *    from memory
+ *  - optionally, the total size of the cache directory is bounded: least recently used entries (by the
+ *    modification time, which is refreshed on every read) are removed when the limit is exceeded
  */
 class FileStorageCacheManager final : public ICacheManager {
-    std::string m_cachePath;
-
-    std::string getBlobFile(const std::string& blobHash) const {
-        return FileUtils::makePath(m_cachePath, blobHash + ".blob");
-    }
-
 public:
     /**
      * @brief Constructor
-     *
+     * @param cachePath Path to the cache directory
+     * @param sizeLimit Upper bound of the cache directory size in bytes, 0 means unlimited
+     * @param asyncWrite Whether the entries are written to disk on a background thread
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    explicit FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit = 0, bool asyncWrite = false);
 
     /**
-     * @brief Destructor
+     * @brief Destructor, waits until all pending entries are written
      *
      */
-    ~FileStorageCacheManager() override = default;
+    ~FileStorageCacheManager() override;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    using Buffer = std::shared_ptr<const std::string>;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
+    std::string getBlobFile(const std::string& blobHash) const {
+        return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
+    void removeCacheEntry(const std::string& id) override;
+
+    void storeBlob(const std::string& id, const StreamWriter& writer);
+    void evict(const std::string& keepFile);
+    void writerLoop();
+
+    std::string m_cachePath;
+    uint64_t m_sizeLimit;
+    bool m_asyncWrite;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::pair<std::string, Buffer>> m_queue;
+    std::map<std::string, Buffer> m_pending;
+    std::thread m_writer;
+    bool m_stop = false;
 };
 
 }  // namespace InferenceEngine
@@ -244,7 +244,30 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         void setAndUpdate(ov::AnyMap& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            bool cacheOptionsChanged = false;
+            auto it = config.find(ov::cache_size_limit.name());
+            if (it != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheSizeLimit = it->second.as<uint64_t>();
+                cacheOptionsChanged = true;
+                config.erase(it);
+            }
+
+            it = config.find(ov::cache_async_write.name());
+            if (it != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheAsyncWrite = it->second.as<std::string>() == CONFIG_VALUE(YES) ? true : false;
+                cacheOptionsChanged = true;
+                config.erase(it);
+            }
+
+            if (cacheOptionsChanged) {
+                // the managers created with the old options are released once no config uses them
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheManagers.clear();
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
                 fillConfig(_cacheConfig, it->second.as<std::string>());
@@ -252,6 +275,13 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                     fillConfig(deviceCfg.second, it->second.as<std::string>());
                 }
                 config.erase(it);
+            } else if (cacheOptionsChanged) {
+                // re-create the cache managers with the new options
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                fillConfig(_cacheConfig, _cacheConfig._cacheDir);
+                for (auto& deviceCfg : _cacheConfigPerDevice) {
+                    fillConfig(deviceCfg.second, deviceCfg.second._cacheDir);
+                }
             }
 
             it = config.find(ov::force_tbb_terminate.name());
@@ -272,6 +302,16 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig._cacheDir;
         }
 
+        uint64_t get_cache_size_limit() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _cacheSizeLimit;
+        }
+
+        bool get_cache_async_write() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _cacheAsyncWrite;
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig getCacheConfigForDevice(const std::string& device_name,
@@ -279,7 +319,10 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                             std::map<std::string, std::string>& parsedConfig) const {
             if (parsedConfig.count(CONFIG_KEY(CACHE_DIR))) {
                 CoreConfig::CacheConfig tempConfig;
-                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)));
+                {
+                    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                    fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)));
+                }
                 if (!deviceSupportsCacheDir) {
                     parsedConfig.erase(CONFIG_KEY(CACHE_DIR));
                 }
@@ -304,11 +347,15 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         }
 
     private:
-        static void fillConfig(CacheConfig& config, const std::string& dir) {
+        // _cacheConfigMutex must be held by the caller
+        void fillConfig(CacheConfig& config, const std::string& dir) const {
             config._cacheDir = dir;
             if (!dir.empty()) {
                 FileUtils::createDirectoryRecursive(dir);
-                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir);
+                auto& manager = _cacheManagers[dir];
+                if (!manager)
+                    manager = std::make_shared<ie::FileStorageCacheManager>(dir, _cacheSizeLimit, _cacheAsyncWrite);
+                config._cacheManager = manager;
             } else {
                 config._cacheManager = nullptr;
             }
@@ -318,6 +365,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+        // One manager per cache directory, also for the cache_dir passed to a single compile_model call, so the
+        // entries of one directory are written by one background writer which outlives the call
+        mutable std::map<std::string, std::shared_ptr<ie::ICacheManager>> _cacheManagers;
+        uint64_t _cacheSizeLimit = 0;
+        bool _cacheAsyncWrite = false;
     };
 
     struct CacheContent {
@@ -987,6 +1039,10 @@ public:
             return decltype(ov::force_tbb_terminate)::value_type(flag);
         } else if (name == ov::cache_dir.name()) {
             return ov::Any(coreConfig.get_cache_dir());
+        } else if (name == ov::cache_size_limit.name()) {
+            return decltype(ov::cache_size_limit)::value_type(coreConfig.get_cache_size_limit());
+        } else if (name == ov::cache_async_write.name()) {
+            return decltype(ov::cache_async_write)::value_type(coreConfig.get_cache_async_write());
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
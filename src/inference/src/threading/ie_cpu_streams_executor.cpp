@@ -4,10 +4,14 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -59,7 +63,12 @@ struct CPUStreamsExecutor::Impl {
         };
 #endif
         explicit Stream(Impl* impl) : _impl(impl) {
-            {
+            const auto& current = currentWorker();
+            if (current._impl == _impl) {
+                // the stream thread is bound by its index, so it is on the NUMA node its victim list is built for
+                _streamId = current._id;
+                _isWorker = true;
+            } else {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
@@ -68,11 +77,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                              ? _impl->_usedNumaNodes.at((_streamId % _impl->_config._streams) /
-                                                         ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1) /
-                                                          _impl->_usedNumaNodes.size()))
-                              : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
                                                                              : _impl->_config._threadsPerStream;
@@ -159,7 +164,7 @@ struct CPUStreamsExecutor::Impl {
 #endif
         }
         ~Stream() {
-            {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -173,6 +178,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl = nullptr;
         int _streamId = 0;
         int _numaNodeId = 0;
+        bool _isWorker = false;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -181,8 +187,60 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    struct ScheduledTask {
+        Task _task;
+        std::chrono::steady_clock::time_point _deadline;
+        Task _onDeadlineMissed;
+    };
+
+    // the number of the tasks the queues hold without growing
+    static constexpr std::size_t initialQueueCapacity = 64;
+
+    // FIFO of the tasks over a buffer, which is preallocated and grows only when it is full, so the steady state
+    // queueing does not allocate as std::deque does for its blocks
+    class TaskRing {
+    public:
+        TaskRing() : _buffer(initialQueueCapacity) {}
+
+        bool Empty() const {
+            return _size == 0;
+        }
+
+        void Push(ScheduledTask&& scheduled) {
+            if (_size == _buffer.size()) {
+                Grow();
+            }
+            _buffer[(_head + _size) % _buffer.size()] = std::move(scheduled);
+            ++_size;
+        }
+
+        void Pop(ScheduledTask& scheduled) {
+            scheduled = std::move(_buffer[_head]);
+            // the moved from slot must not keep the captured objects alive
+            _buffer[_head] = {};
+            _head = (_head + 1) % _buffer.size();
+            --_size;
+        }
+
+    private:
+        void Grow() {
+            std::vector<ScheduledTask> buffer(_buffer.size() * 2);
+            for (std::size_t i = 0; i < _size; ++i) {
+                buffer[i] = std::move(_buffer[(_head + i) % _buffer.size()]);
+            }
+            _buffer.swap(buffer);
+            _head = 0;
+        }
+
+        std::vector<ScheduledTask> _buffer;
+        std::size_t _head = 0;
+        std::size_t _size = 0;
+    };
+
     explicit Impl(const Config& config)
         : _config{config},
+          // the ids below the number of streams belong to the stream threads
+          _streamId{config._streams},
           _streams([this] {
               return std::make_shared<Impl::Stream>(this);
           }) {
@@ -217,35 +275,193 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto& count : _taskCount) {
+            count = 0;
+        }
+        for (auto& count : _deadlineTaskCount) {
+            count = 0;
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _workers.emplace_back(new Worker);
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            // the own queue is checked first, then the queues of the same NUMA node and then all the other ones
+            auto& victims = _workers[streamId]->_victims;
+            const auto numaNodeId = GetNumaNodeId(streamId);
+            for (auto sameNuma : {true, false}) {
+                for (auto offset = 0; offset < _config._streams; ++offset) {
+                    const auto victim = (streamId + offset) % _config._streams;
+                    if ((GetNumaNodeId(victim) == numaNodeId) == sameNuma)
+                        victims.push_back(victim);
+                }
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                currentWorker() = {this, streamId};
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                    // spinning keeps the thread awake for the tasks which come in bursts, e.g. the pipeline stages
+                    // of the infer requests, without the futex call on each of them
+                    for (int spin = 0; !Pop(streamId, task) && spin < spinCount; ++spin) {
+                        std::this_thread::yield();
                     }
                     if (task) {
                         Execute(task, *(_streams.local()));
+                    } else {
+                        std::unique_lock<std::mutex> lock(_parkMutex);
+                        _parkedWorkers.fetch_add(1);
+                        _parkCondVar.wait(lock, [&] {
+                            return HasTasks() || (stopped = _isStopped);
+                        });
+                        _parkedWorkers.fetch_sub(1);
                     }
                 }
             });
         }
     }
 
+    struct CurrentWorker {
+        const Impl* _impl;
+        int _id;
+    };
+
+    static CurrentWorker& currentWorker() {
+        static thread_local CurrentWorker worker{nullptr, 0};
+        return worker;
+    }
+
+    int GetNumaNodeId(int streamId) const {
+        return _config._streams
+                   ? _usedNumaNodes.at((streamId % _config._streams) /
+                                       ((_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size()))
+                   : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
+    bool HasTasks() const {
+        for (const auto& count : _taskCount) {
+            if (count.load() > 0)
+                return true;
+        }
+        return false;
+    }
+
+    static bool LaterDeadline(const ScheduledTask& lhs, const ScheduledTask& rhs) {
+        return lhs._deadline > rhs._deadline;
+    }
+
+    // Takes the task with the earliest deadline of the queue or the first one without deadline, the queue must be
+    // locked
+    bool Take(int workerId, int level, ScheduledTask& scheduled) {
+        auto& queue = _workers[workerId]->_queues[level];
+        if (!queue._byDeadline.empty()) {
+            std::pop_heap(queue._byDeadline.begin(), queue._byDeadline.end(), LaterDeadline);
+            scheduled = std::move(queue._byDeadline.back());
+            queue._byDeadline.pop_back();
+            _deadlineTaskCount[level].fetch_sub(1);
+        } else if (!queue._fifo.Empty()) {
+            queue._fifo.Pop(scheduled);
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // The deadline heap tops of all the queues of the level are compared, so the tasks with deadline are started
+    // in the deadline order regardless of the stream they are posted to
+    bool TakeEarliestDeadline(int workerId, int level, ScheduledTask& scheduled) {
+        int earliest = -1;
+        auto deadline = std::chrono::steady_clock::time_point::max();
+        for (auto victim : _workers[workerId]->_victims) {
+            auto& worker = *_workers[victim];
+            std::unique_lock<std::mutex> lock(worker._mutex, std::defer_lock);
+            if (victim == workerId) {
+                lock.lock();
+            } else if (!lock.try_lock()) {
+                continue;
+            }
+            const auto& heap = worker._queues[level]._byDeadline;
+            if (!heap.empty() && heap.front()._deadline < deadline) {
+                deadline = heap.front()._deadline;
+                earliest = victim;
+            }
+        }
+        if (earliest < 0)
+            return false;
+        auto& worker = *_workers[earliest];
+        std::lock_guard<std::mutex> lock(worker._mutex);
+        // the task may be taken by another thread meanwhile, the next one of the same queue is taken then
+        return !worker._queues[level]._byDeadline.empty() && Take(earliest, level, scheduled);
+    }
+
+    bool Pop(int workerId, Task& task) {
+        // the higher priority tasks are taken from all the queues before the lower priority ones
+        for (int level = priorityLevels - 1; level >= 0; --level) {
+            // the counters are checked without locking, so the idle threads do not touch the queues
+            if (_taskCount[level].load(std::memory_order_relaxed) <= 0)
+                continue;
+            ScheduledTask scheduled;
+            bool taken = _deadlineTaskCount[level].load(std::memory_order_relaxed) > 0 &&
+                         TakeEarliestDeadline(workerId, level, scheduled);
+            for (auto victim : _workers[workerId]->_victims) {
+                if (taken || _taskCount[level].load(std::memory_order_relaxed) <= 0)
+                    break;
+                auto& worker = *_workers[victim];
+                std::unique_lock<std::mutex> lock(worker._mutex, std::defer_lock);
+                if (victim == workerId) {
+                    lock.lock();
+                } else if (!lock.try_lock()) {
+                    // the queue is busy, it will be checked again on the next spin
+                    continue;
+                }
+                taken = Take(victim, level, scheduled);
+            }
+            if (!taken)
+                continue;
+            _taskCount[level].fetch_sub(1);
+            // the late task is shed, so it does not delay the ones which still can meet the deadline
+            if (scheduled._onDeadlineMissed && std::chrono::steady_clock::now() > scheduled._deadline) {
+                task = std::move(scheduled._onDeadlineMissed);
+            } else {
+                task = std::move(scheduled._task);
+            }
+            return true;
+        }
+        return false;
+    }
+
     void Enqueue(Task task) {
+        Enqueue(ScheduledTask{std::move(task), std::chrono::steady_clock::time_point::max(), {}},
+                TaskSchedulingHints::defaultPriority);
+    }
+
+    void Enqueue(ScheduledTask scheduled, int priority) {
+        const auto level = std::min(std::max(priority, 0), priorityLevels - 1);
+        // the task posted by the stream goes to its own queue, the external ones are spread round-robin
+        const auto& current = currentWorker();
+        const auto workerId = current._impl == this
+                                  ? current._id
+                                  : static_cast<int>(_nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                                                     _workers.size());
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            auto& queue = _workers[workerId]->_queues[level];
+            std::lock_guard<std::mutex> lock(_workers[workerId]->_mutex);
+            if (scheduled._deadline != std::chrono::steady_clock::time_point::max()) {
+                queue._byDeadline.push_back(std::move(scheduled));
+                std::push_heap(queue._byDeadline.begin(), queue._byDeadline.end(), LaterDeadline);
+                _deadlineTaskCount[level].fetch_add(1);
+            } else {
+                queue._fifo.Push(std::move(scheduled));
+            }
+        }
+        // pairs with the check of the counters by the parking thread, so either the thread sees the task or
+        // the parked thread is seen here
+        _taskCount[level].fetch_add(1);
+        if (_parkedWorkers.load() > 0) {
+            std::lock_guard<std::mutex> lock(_parkMutex);
+            _parkCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -282,9 +498,32 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
-    std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    // the queues of a stream thread per priority, the other threads steal from them when their own ones are empty
+    static constexpr int priorityLevels = 3;
+    struct Worker {
+        std::mutex _mutex;
+        struct Queue {
+            Queue() {
+                _byDeadline.reserve(initialQueueCapacity);
+            }
+            // the tasks with deadline are taken first, the earliest one at the top of the heap
+            std::vector<ScheduledTask> _byDeadline;
+            TaskRing _fifo;
+        };
+        std::array<Queue, priorityLevels> _queues;
+        std::vector<int> _victims;
+    };
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::atomic<std::size_t> _nextWorker{0};
+    // number of the tasks in all the queues per priority, it may be negative for a moment as the task is counted
+    // after the push
+    std::array<std::atomic<std::int64_t>, priorityLevels> _taskCount;
+    // number of the tasks with deadline, the heaps of the other queues are checked only if there are such tasks
+    std::array<std::atomic<std::int64_t>, priorityLevels> _deadlineTaskCount;
+    static constexpr int spinCount = 128;
+    std::atomic<int> _parkedWorkers{0};
+    std::mutex _parkMutex;
+    std::condition_variable _parkCondVar;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
@@ -313,10 +552,10 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
     {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
+        std::lock_guard<std::mutex> lock(_impl->_parkMutex);
         _impl->_isStopped = true;
     }
-    _impl->_queueCondVar.notify_all();
+    _impl->_parkCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -328,6 +567,14 @@ void CPUStreamsExecutor::Execute(Task task) {
     _impl->Defer(std::move(task));
 }
 
+void CPUStreamsExecutor::runScheduled(Task task, const TaskSchedulingHints& hints) {
+    if (0 == _impl->_config._streams) {
+        IStreamsExecutor::runScheduled(std::move(task), hints);
+    } else {
+        _impl->Enqueue(Impl::ScheduledTask{std::move(task), hints.deadline, hints.onDeadlineMissed}, hints.priority);
+    }
+}
+
 void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
@@ -11,6 +11,8 @@
 
 namespace InferenceEngine {
 
+constexpr int TaskSchedulingHints::defaultPriority;
+
 void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
@@ -35,4 +37,18 @@ void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
         future.get();
     }
 }
+
+void ITaskExecutor::runScheduled(Task task, const TaskSchedulingHints& hints) {
+    if (!hints.hasDeadline() || !hints.onDeadlineMissed) {
+        run(std::move(task));
+        return;
+    }
+    run([task, hints] {
+        if (std::chrono::steady_clock::now() > hints.deadline) {
+            hints.onDeadlineMissed();
+        } else {
+            task();
+        }
+    });
+}
 }  // namespace InferenceEngine
@@ -86,6 +86,7 @@ void AutoBatchInferRequest::ShareBlobsWithBatchRequest(const std::set<std::strin
     // Allocate all input blobs
     for (const auto& it : _networkInputs) {
         auto blob = _myBatchedRequestWrapper._inferRequestBatched->GetBlob(it.first);
+        _batchedInputBlobs[it.first] = blob;
         Blob::Ptr res;
         switch (it.second->getTensorDesc().getPrecision()) {
         case InferenceEngine::Precision::FP32:
@@ -333,13 +334,27 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        // (the batched blobs are cached, as the requests of the batch may call this concurrently)
+        CopyBlobIfNeeded(GetBlob(name), _batchedInputBlobs[name], true, _batchId);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToPartialBatch(size_t partialBatchId) {
+    _partialBatchId = partialBatchId;
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestPartial->GetBlob(name),
+                         true,
+                         _partialBatchId);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -347,13 +362,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / _batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / _batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -365,7 +380,18 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false, _batchId);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromPartialBatch() {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestPartial->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _partialBatchId);
     }
 }
 
@@ -381,13 +407,31 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
         explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
         void run(Task task) override {
             auto& workerInferRequest = _this->_inferRequest->_myBatchedRequestWrapper;
+            // by default the request blobs are views into its slot of the batched blobs, so nothing is copied here.
+            // Otherwise (user-set blobs) the data is gathered by each submitting thread rather than serially by the
+            // worker before the batch can start. The slot is not read until all the requests of the batch arrive.
+            // While the batches time out, the copy would be wasted, so it is left to the worker then
+            _this->_inferRequest->_inputsGathered = workerInferRequest._lastBatchFull;
+            if (_this->_inferRequest->_inputsGathered)
+                _this->_inferRequest->CopyInputsIfNeeded();
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = workerInferRequest._tasks.size();
-            if (sz == workerInferRequest._batchSize) {
+            // running average of the time between the requests arrival, to adapt the batch collection timeout
+            // (the gap before the first request of a batch is the idle time between the bursts, so it is skipped)
+            const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+                                    std::chrono::steady_clock::now().time_since_epoch())
+                                    .count();
+            const int64_t prev = workerInferRequest._lastArrival.exchange(now);
+            if (prev && sz > 1) {
+                const int64_t interval = workerInferRequest._arrivalInterval;
+                workerInferRequest._arrivalInterval = interval ? (3 * interval + now - prev) / 4 : now - prev;
+            }
+            // the first request starts the batch collection timeout, the last one completes the batch
+            if (sz == 1 || sz == workerInferRequest._batchSize) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -403,6 +447,9 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
                       if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED ==
                           this->_inferRequest->_wasBatchedRequestUsed)
                           this->_inferRequest->CopyOutputsIfNeeded();
+                      else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED ==
+                               this->_inferRequest->_wasBatchedRequestUsed)
+                          this->_inferRequest->CopyOutputsFromPartialBatch();
                   }}};
 }
 
@@ -411,6 +458,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_myBatchedRequestWrapper._inferRequestPartial->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -516,11 +565,28 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // the moment the first request of the currently collected batch was noticed
+            std::chrono::steady_clock::time_point batchStart;
+            bool collecting = false;
             while (1) {
-                std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    // the requests that arrived while the previous batch was started do not notify
+                    const int pending = workerRequestPtr->_tasks.size();
+                    if (!collecting && pending) {
+                        collecting = true;
+                        batchStart = std::chrono::steady_clock::now();
+                    }
+                    // no waiting if the full batch is already collected,
+                    // while the previous partial batch is in flight, its completion notifies
+                    if (pending != workerRequestPtr->_batchSize) {
+                        if (collecting && !workerRequestPtr->_partialInFlight)
+                            workerRequestPtr->_cond.wait_until(
+                                lock,
+                                batchStart + GetBatchCollectionTimeout(*workerRequestPtr));
+                        else
+                            workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    }
                 }
                 if (_terminate) {
                     break;
@@ -528,40 +594,45 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     // as we pop the tasks from the queue only here
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = workerRequestPtr->_tasks.size();
+                    if (!sz) {
+                        collecting = false;
+                        continue;
+                    }
+                    const auto now = std::chrono::steady_clock::now();
+                    if (!collecting) {
+                        collecting = true;
+                        batchStart = now;
+                    }
                     if (sz == workerRequestPtr->_batchSize) {
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             workerRequestPtr->_completionTasks[n] = std::move(t.second);
-                            t.first->_inferRequest->CopyInputsIfNeeded();
+                            // the requests submitted while the batches were timing out are gathered here
+                            if (!t.first->_inferRequest->_inputsGathered)
+                                t.first->_inferRequest->CopyInputsIfNeeded();
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_lastBatchFull = true;
                         workerRequestPtr->_inferRequestBatched->StartAsync();
-                    } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->_inferRequestWithoutBatch->SetCallback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->_inferRequest->_exceptionPtr = p;
-                                    t.second();
-                                    if (sz == ++arrived)
-                                        all_completed.set_value();
-                                });
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
-                            t.first->_inferRequestWithoutBatch->StartAsync();
+                        collecting = false;
+                    } else if (now >= batchStart + GetBatchCollectionTimeout(*workerRequestPtr)) {
+                        // timeout to collect the batch is over, execute what is collected either as a partial batch
+                        // or in the batch1 mode, whichever was observed to be faster for the number of requests
+                        const int64_t partialLatency = workerRequestPtr->_partialLatency;
+                        const int64_t batch1Latency = workerRequestPtr->_batch1Latency;
+                        const bool partial =
+                            sz > 1 && (!partialLatency || !batch1Latency || partialLatency < sz * batch1Latency);
+                        workerRequestPtr->_lastBatchFull = false;
+                        if (!partial) {
+                            ExecuteBatch1(*workerRequestPtr, sz);
+                            collecting = false;
+                        } else if (!workerRequestPtr->_partialInFlight) {
+                            // otherwise keep collecting, the previous partial batch notifies on the completion
+                            ExecutePartialBatch(*workerRequestPtr, sz);
+                            collecting = false;
                         }
-                        all_completed_future.get();
-                        // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
             }
@@ -570,6 +641,81 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     return {*_workerRequests.back(), batch_id};
 }
 
+std::chrono::microseconds AutoBatchExecutableNetwork::GetBatchCollectionTimeout(
+    const WorkerInferRequest& workerRequest) const {
+    const std::chrono::microseconds timeout = std::chrono::milliseconds(_timeOut);
+    const int64_t interval = workerRequest._arrivalInterval;
+    if (!interval)
+        return timeout;
+    // no reason to wait longer than the time the full batch is expected to be collected in (with a margin for the
+    // jitter), as otherwise the burst of requests is over and the rest of the batch is unlikely to arrive
+    const std::chrono::microseconds expected(2 * interval * (workerRequest._batchSize - 1));
+    return std::min(timeout, expected);
+}
+
+void AutoBatchExecutableNetwork::ExecutePartialBatch(WorkerInferRequest& workerRequest, int numTasks) {
+    if (!workerRequest._inferRequestPartial) {
+        auto workerRequestPtr = &workerRequest;
+        workerRequest._inferRequestPartial = {_network->CreateInferRequest(), _network._so};
+        workerRequest._inferRequestPartial->SetCallback([workerRequestPtr](std::exception_ptr exceptionPtr) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - workerRequestPtr->_partialStart)
+                                     .count();
+            const int64_t latency = workerRequestPtr->_partialLatency;
+            workerRequestPtr->_partialLatency = latency ? (3 * latency + elapsed) / 4 : elapsed;
+            for (auto& t : workerRequestPtr->_partialTasks) {
+                if (exceptionPtr)
+                    t.first->_inferRequest->_exceptionPtr = exceptionPtr;
+                t.second();
+            }
+            workerRequestPtr->_partialTasks.clear();
+            workerRequestPtr->_partialInFlight = false;
+            workerRequestPtr->_cond.notify_one();
+        });
+    }
+    workerRequest._partialStart = std::chrono::steady_clock::now();
+    workerRequest._partialInFlight = true;
+    // the collected requests occupy the first slots of the batch, the rest of the slots are computed idle
+    std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+    for (int n = 0; n < numTasks; n++) {
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+        t.first->_inferRequest->CopyInputsToPartialBatch(n);
+        t.first->_inferRequest->_wasBatchedRequestUsed =
+            AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+        workerRequest._partialTasks.push_back(std::move(t));
+    }
+    workerRequest._inferRequestPartial->StartAsync();
+}
+
+void AutoBatchExecutableNetwork::ExecuteBatch1(WorkerInferRequest& workerRequest, int numTasks) {
+    const auto start = std::chrono::steady_clock::now();
+    std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+    // popping all tasks collected by the moment of the time-out and execute each with batch1
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    for (int n = 0; n < numTasks; n++) {
+        IE_ASSERT(workerRequest._tasks.try_pop(t));
+        t.first->_inferRequestWithoutBatch->SetCallback([t, numTasks, &arrived, &all_completed](std::exception_ptr p) {
+            if (p)
+                t.first->_inferRequest->_exceptionPtr = p;
+            t.second();
+            if (numTasks == ++arrived)
+                all_completed.set_value();
+        });
+        t.first->_inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+        t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+        t.first->_inferRequestWithoutBatch->StartAsync();
+    }
+    all_completed_future.get();
+    // now when all the tasks for this batch are completed, start waiting for the timeout again
+    const int64_t elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() /
+        numTasks;
+    const int64_t latency = workerRequest._batch1Latency;
+    workerRequest._batch1Latency = latency ? (3 * latency + elapsed) / 4 : elapsed;
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
     if (!_network) {
         auto res = _networkWithoutBatch->CreateInferRequest();
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -43,6 +44,22 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+
+        // statistics to adapt the batch collection time and the partial batch vs batch1 choice, all in us
+        std::atomic<int64_t> _lastArrival = {0};
+        std::atomic<int64_t> _arrivalInterval = {0};
+        std::atomic<int64_t> _partialLatency = {0};
+        std::atomic<int64_t> _batch1Latency = {0};
+        // whether the last collected batch was full, the submitting threads gather the inputs into the batch
+        // ahead of time only then, as the timed out requests do not read the batch
+        std::atomic_bool _lastBatchFull = {true};
+
+        std::vector<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _partialTasks;
+        std::atomic_bool _partialInFlight = {false};
+        std::chrono::steady_clock::time_point _partialStart;
+        // separate request to run the partially collected batch, so the outputs of the idle slots stay intact
+        // (declared last, as its destructor waits for the callback that uses the rest of the members)
+        InferenceEngine::SoIInferRequestInternal _inferRequestPartial;
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -75,6 +92,9 @@ protected:
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    std::chrono::microseconds GetBatchCollectionTimeout(const WorkerInferRequest& workerRequest) const;
+    void ExecutePartialBatch(WorkerInferRequest& workerRequest, int numTasks);
+    void ExecuteBatch1(WorkerInferRequest& workerRequest, int numTasks);
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
     std::mutex _workerRequestsMutex;
 
@@ -109,20 +129,31 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // partial batch is executed with a separate request, the data is copied to/from the given slot of it
+    void CopyInputsToPartialBatch(size_t partialBatchId);
+    void CopyOutputsFromPartialBatch();
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
+        PARTIAL_BATCH_EXECUTED,
         TIMEOUT_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    // the inputs were copied into the slot of the batch by the submitting thread
+    bool _inputsGathered = false;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
     size_t _batchSize;
+    size_t _partialBatchId = 0;
+    std::unordered_map<std::string, InferenceEngine::Blob::Ptr> _batchedInputBlobs;
 };
 
 class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -4,8 +4,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <functional>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "lru_cache.h"
 
 namespace ov {
@@ -17,18 +23,32 @@ public:
         Hit,
         Miss
     };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
+
 public:
     virtual ~CacheEntryBase() = default;
+
+    virtual Statistics getStatistics() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide bool put(KeyType, ValueType) returning whether a record was evicted
+ *         and ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The entry is thread safe. The records are distributed over several shards by the key hash, each shard has its own
+ *       lock and its own LRU order, so the lookups of different keys rarely contend. Small caches use a single shard
+ *       to keep the exact LRU eviction policy. The builder is called outside of the lock, a key being built is
+ *       registered in the shard as in flight, so concurrent requests of the same key wait for the first builder
+ *       and the value is built only once. The builder may use the same cache for the other keys.
  */
 
 template<typename KeyType,
@@ -39,7 +59,14 @@ public:
     using ResultType = std::pair<ValType, LookUpStatus>;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    explicit CacheEntry(size_t capacity) : _capacity(capacity) {
+        const size_t numShards = getNumShards(capacity);
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            // the remainder goes to the first shards, so the shard capacities sum up to the entry capacity
+            _shards.emplace_back(new Shard(capacity / numShards + (i < capacity % numShards ? 1 : 0)));
+        }
+    }
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -50,24 +77,91 @@ public:
      */
 
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
-        if (0 == _impl.getCapacity()) {
+        if (0 == _capacity) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
-        auto retStatus = LookUpStatus::Hit;
-        ValType retVal = _impl.get(key);
-        auto retEmpty = ValType();
-        if (retVal == retEmpty) {
-            retStatus = LookUpStatus::Miss;
+        auto& shard = *_shards[static_cast<size_t>(key.hash()) % _shards.size()];
+        const auto retEmpty = ValType();
+        std::unique_lock<std::mutex> lock(shard.mutex);
+
+        ValType retVal = shard.impl.get(key);
+        if (retVal != retEmpty) {
+            lock.unlock();
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return {retVal, LookUpStatus::Hit};
+        }
+
+        auto inFlight = shard.inFlight.find(key);
+        if (inFlight != shard.inFlight.end()) {
+            // the value is being built by another thread
+            auto future = inFlight->second;
+            lock.unlock();
+            retVal = future.get();
+            _hits.fetch_add(1, std::memory_order_relaxed);
+            return {retVal, LookUpStatus::Hit};
+        }
+
+        std::promise<ValType> promise;
+        shard.inFlight.emplace(key, promise.get_future().share());
+        lock.unlock();
+
+        try {
             retVal = builder(key);
-            if (retVal != retEmpty)
-                _impl.put(key, retVal);
+        } catch (...) {
+            lock.lock();
+            shard.inFlight.erase(key);
+            lock.unlock();
+            promise.set_exception(std::current_exception());
+            throw;
         }
-        return {retVal, retStatus};
+
+        lock.lock();
+        if (retVal != retEmpty && shard.impl.put(key, retVal))
+            _evictions.fetch_add(1, std::memory_order_relaxed);
+        shard.inFlight.erase(key);
+        lock.unlock();
+        promise.set_value(retVal);
+
+        _misses.fetch_add(1, std::memory_order_relaxed);
+        return {retVal, LookUpStatus::Miss};
     }
 
-public:
-    ImplType _impl;
+    Statistics getStatistics() const override {
+        Statistics stat;
+        stat.hits = _hits.load(std::memory_order_relaxed);
+        stat.misses = _misses.load(std::memory_order_relaxed);
+        stat.evictions = _evictions.load(std::memory_order_relaxed);
+        return stat;
+    }
+
+private:
+    struct KeyHasher {
+        size_t operator()(const KeyType& key) const {
+            return static_cast<size_t>(key.hash());
+        }
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : impl(capacity) {}
+        std::mutex mutex;
+        ImplType impl;
+        // the keys which are being built outside of the lock
+        std::unordered_map<KeyType, std::shared_future<ValType>, KeyHasher> inFlight;
+    };
+
+    static size_t getNumShards(size_t capacity) {
+        constexpr size_t maxShards = 16;
+        constexpr size_t minRecordsPerShard = 64;
+        return std::max<size_t>(1, std::min(maxShards, capacity / minRecordsPerShard));
+    }
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic<size_t> _hits{0};
+    std::atomic<size_t> _misses{0};
+    std::atomic<size_t> _evictions{0};
 };
 
 }   // namespace intel_cpu
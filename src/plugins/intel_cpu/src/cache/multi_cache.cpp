@@ -9,5 +9,17 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheEntryBase::Statistics MultiCache::getStatistics() const {
+    CacheEntryBase::Statistics total;
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        const auto stat = item.second->getStatistics();
+        total.hits += stat.hits;
+        total.misses += stat.misses;
+        total.evictions += stat.evictions;
+    }
+    return total;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
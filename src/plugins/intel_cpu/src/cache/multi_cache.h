@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,7 +16,9 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache is thread safe and is shared by all the streams of a compiled model and by the compiled models of one plugin
+ *       instance (see CacheEntry for the locking scheme). The cached values must not be modified after creation
+ *       as they are used by several nodes concurrently.
  */
 
 class MultiCache {
@@ -49,6 +52,16 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Accumulates the lookup statistics over all the entries
+    * @return number of hits, misses and evicted records
+    */
+    CacheEntryBase::Statistics getStatistics() const;
+
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -59,6 +72,7 @@ private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    mutable std::mutex _storageMutex;
 };
 
 template<typename T>
@@ -71,6 +85,7 @@ template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -149,6 +149,22 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_PER_NETWORK == key) {
+            if (val == PluginConfigParams::YES)
+                rtCachePerNetwork = true;
+            else if (val == PluginConfigParams::NO)
+                rtCachePerNetwork = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_PER_NETWORK
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES == key) {
+            if (val == PluginConfigParams::YES)
+                parallelBranches = true;
+            else if (val == PluginConfigParams::NO)
+                parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -102,7 +102,10 @@ public:
     void registerMemory(Memory* memPtr);
     void unregisterMemory(Memory* memPtr);
 
-private:
+    /**
+     * @brief Propagates the current raw pointer to all the registered Memory objects.
+     * Must be called if the underlying memory manager has been moved to another buffer bypassing this proxy.
+     */
     void notifyUpdate();
 
 private:
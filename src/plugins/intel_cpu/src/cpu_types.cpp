@@ -198,6 +198,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "PriorBox", Type::PriorBox},
         { "PriorBoxClustered", Type::PriorBoxClustered},
         { "MHA", Type::MHA},
+        { "Preprocess", Type::Preprocess},
 };
 
 Type TypeFromName(const std::string& type) {
@@ -391,6 +392,8 @@ std::string NameFromType(const Type type) {
             return "Subgraph";
         case Type::MHA:
             return "MHA";
+        case Type::Preprocess:
+            return "Preprocess";
         default:
             return "Unknown";
     }
@@ -108,7 +108,8 @@ enum class Type {
     Subgraph,
     PriorBox,
     PriorBoxClustered,
-    MHA
+    MHA,
+    Preprocess
 };
 
 enum class Algorithm {
@@ -33,6 +33,10 @@ bool Edge::isUseExternalMemory() const {
     return useExternalMemory;
 }
 
+bool Edge::hasOwnMemory() const {
+    return ownMemory;
+}
+
 bool Edge::isDropped() const {
     bool not_in_parent = true;
     bool not_in_child = true;
@@ -319,6 +323,7 @@ void Edge::allocateCommon(const std::function<void(const MemoryPtr&, const Memor
 
     allocate(memoryPtr, inputDesc);
     DEBUG_LOG(*this, " memoryPtr=", memoryPtr);
+    ownMemory = true;
     status = Status::Allocated;
 }
 
@@ -367,6 +372,7 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
         memoryPtr = *ptr;
         DEBUG_LOG(*this, " memoryPtr=", memoryPtr);
         useExternalMemory = true;
+        ownMemory = true;
         status = Status::Allocated;
     } else {
         allocate();
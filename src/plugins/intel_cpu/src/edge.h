@@ -66,6 +66,10 @@ public:
     ReorderStatus needReorder();
     bool isDropped() const;
     bool isUseExternalMemory() const;
+    /**
+     * @brief The memory is allocated for the edge, i.e. it is not a view of another edge or the memory of a constant
+     */
+    bool hasOwnMemory() const;
 
     int getInputNum() const;
     int getOutputNum() const;
@@ -89,6 +93,7 @@ private:
     int child_port;
 
     bool useExternalMemory = false;
+    bool ownMemory = false;
     EdgeWeakPtr memoryFromEdge;
     MemoryPtr memoryPtr;
     Status status = Status::Uninitialized;
@@ -191,6 +191,10 @@ TileSchedulerEmitter::TileSchedulerEmitter(dnnl::impl::cpu::x64::jit_generator*
     if (!tile_scheduler->compile_params)
         IE_THROW() << "TileEmitter invoked without compile_params";
     body = {tile_scheduler->vector_region, tile_scheduler->scalar_region};
+    for (const auto& region : tile_scheduler->reduction_regions) {
+        body.push_back(region.first);
+        body.push_back(region.second);
+    }
     jcp = *reinterpret_cast<const jit_snippets_compile_args*>(tile_scheduler->compile_params);
 }
 void TileSchedulerEmitter::emit_code(const std::vector<size_t> &in,
@@ -208,18 +212,20 @@ void TileSchedulerEmitter::validate_arguments(const std::vector<size_t> &in,
         IE_THROW() << "TileSchedulerEmitter got invalid number of inputs. Expected 3, got " << in.size();
     if (out.size() != in[0] + in[1])
         IE_THROW() << "TileSchedulerEmitter got invalid number of outputs. Expected " << in[0] + in[1] << " , got " << out.size();
-    if (body.size() != 2)
-        IE_THROW() << "TileSchedulerEmitter got invalid body size, expected 2 (vector & scalar TileEmitter), got " << body.size();
-    if (!(std::dynamic_pointer_cast<TileEmitter>(body[0].first) && std::dynamic_pointer_cast<TileEmitter>(body[1].first)))
-        IE_THROW() << "TileSchedulerEmitter can contain only TileEmitters inside its body";
+    if (body.size() < 2 || body.size() % 2 != 0)
+        IE_THROW() << "TileSchedulerEmitter got invalid body size, expected pairs of vector & scalar TileEmitters, got " << body.size();
+    for (const auto& code : body) {
+        if (!std::dynamic_pointer_cast<TileEmitter>(code.first))
+            IE_THROW() << "TileSchedulerEmitter can contain only TileEmitters inside its body";
+    }
 }
 
 void TileSchedulerEmitter::emit_tiles(const Reg64& reg_inner_amount, const std::vector<Reg64>& data_ptr_regs, size_t vector_size,
-                                      const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool) const {
+                                      const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool, size_t region) const {
     // TileAllocatedEmitter is just an alias to perform dynamic_pointer_cast only once and reuse it below several times
     using TileAllocatedEmitter = std::pair<std::shared_ptr<TileEmitter>, const ngraph::snippets::RegInfo&>;
-    TileAllocatedEmitter vector_tile {std::dynamic_pointer_cast<TileEmitter>(body[0].first), body[0].second};
-    TileAllocatedEmitter scalar_tile {std::dynamic_pointer_cast<TileEmitter>(body[1].first), body[1].second};
+    TileAllocatedEmitter vector_tile {std::dynamic_pointer_cast<TileEmitter>(body[2 * region].first), body[2 * region].second};
+    TileAllocatedEmitter scalar_tile {std::dynamic_pointer_cast<TileEmitter>(body[2 * region + 1].first), body[2 * region + 1].second};
     const size_t inner_work_amount = jcp.scheduler_dims[1];
     auto process_tile =
         [&](const bool evaluate_once, const TileAllocatedEmitter& tile) {
@@ -285,17 +291,40 @@ void TileSchedulerEmitter::emit_impl(const std::vector<size_t>& in,
     local_gpr_pool.pop_back();
     Reg64 reg_inner_amount = Reg64(static_cast<int>(local_gpr_pool.back()));
     local_gpr_pool.pop_back();
+    // Reduction stages go over the same row before the main Tiles: the accumulators are initialized, the stage Tiles
+    // are executed and then the accumulators are reduced horizontally. Data pointers are restored after every stage.
+    auto emit_row = [&]() {
+        for (size_t region = 1; region < body.size() / 2; region++) {
+            std::vector<std::pair<std::shared_ptr<ReduceEmitter>, size_t>> accumulators;
+            for (const auto& code : std::dynamic_pointer_cast<TileEmitter>(body[2 * region].first)->get_nested_code()) {
+                if (const auto& reduce = std::dynamic_pointer_cast<ReduceEmitter>(code.first))
+                    accumulators.emplace_back(reduce, code.second.second[0]);
+            }
+            if (vec_pool.empty())
+                IE_THROW() << "TileSchedulerEmitter doesn't have a free vector register for the horizontal reduction";
+            for (const auto& acc : accumulators)
+                acc.first->emit_init(acc.second, static_cast<size_t>(reg_inner_amount.getIdx()));
+            for (const auto& reg : data_ptr_regs)
+                h->push(reg);
+            emit_tiles(reg_inner_amount, data_ptr_regs, vector_size, vec_pool, local_gpr_pool, region);
+            for (auto reg = data_ptr_regs.rbegin(); reg != data_ptr_regs.rend(); reg++)
+                h->pop(*reg);
+            for (const auto& acc : accumulators)
+                acc.first->emit_horizontal(acc.second, vec_pool.front());
+        }
+        emit_tiles(reg_inner_amount, data_ptr_regs, vector_size, vec_pool, local_gpr_pool, 0);
+    };
     Label for_body;
     const size_t outer_work_amount = jcp.scheduler_dims[0];
     if (outer_work_amount == 1) {
         // emit code directly without looping over external dim
-        emit_tiles(reg_inner_amount, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
+        emit_row();
     } else if (outer_work_amount > 1) {
         // We need to create a Loop in this case
         h->mov(reg_outer_amount, outer_work_amount);
         h->L(for_body);
         {
-            emit_tiles(reg_inner_amount, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
+            emit_row();
 
             // Todo: Load and Store emitters are currently implemented so they ALWAYS increment appropriate pointers
             //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
@@ -469,6 +498,132 @@ void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<si
 }
 
 
+ReduceEmitter::ReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
+                             const std::shared_ptr<ov::Node>& n) : jit_emitter(h, isa, n) {
+    const auto reduce = ov::as_type_ptr<ngraph::snippets::op::ReduceBase>(n);
+    if (!reduce)
+        IE_THROW() << "ReduceEmitter invoked with invalid op argument";
+    if (n->get_input_element_type(0) != ov::element::f32)
+        IE_THROW() << "ReduceEmitter supports only f32 but gets: " << n->get_input_element_type(0);
+    is_max = ov::is_type<ngraph::snippets::op::ReduceMax>(n);
+    count = reduce->get_count();
+}
+
+size_t ReduceEmitter::aux_vecs_count() const {
+    // sse41 updates only the first lane with scalar instructions, while the VEX-encoded ones would zero the upper lanes
+    return count == 1 && host_isa_ != dnnl::impl::cpu::x64::sse41 ? 1 : 0;
+}
+
+void ReduceEmitter::emit_impl(const std::vector<size_t>& in,
+                              const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool,
+                              const std::vector<size_t>& gpr,
+                              const ov::intel_cpu::emitter_context *emit_context) const {
+    if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+        emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+        emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+        emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+    } else {
+        IE_THROW() << "Reduce emitter doesn't support " << host_isa_;
+    }
+}
+
+template <typename Vmm>
+void ReduceEmitter::emit_op(const Vmm& acc, const Vmm& src) const {
+    if (is_max)
+        h->uni_vmaxps(acc, acc, src);
+    else
+        h->uni_vaddps(acc, acc, src);
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+void ReduceEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in[0]);
+    Vmm vmm_acc = Vmm(out[0]);
+    if (count != 1) {
+        emit_op(vmm_acc, vmm_src);
+    } else if (isa == dnnl::impl::cpu::x64::sse41) {
+        if (is_max)
+            h->maxss(Xmm(out[0]), Xmm(in[0]));
+        else
+            h->addss(Xmm(out[0]), Xmm(in[0]));
+    } else {
+        Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+        if (is_max) {
+            h->uni_vbroadcastss(vmm_aux, Xmm(in[0]));
+        } else {
+            h->uni_vpxor(vmm_aux, vmm_aux, vmm_aux);
+            h->vmovss(Xmm(aux_vec_idxs[0]), Xmm(aux_vec_idxs[0]), Xmm(in[0]));
+        }
+        emit_op(vmm_acc, vmm_aux);
+    }
+}
+
+void ReduceEmitter::emit_init(size_t acc, size_t gpr) const {
+    if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+        emit_init_isa<dnnl::impl::cpu::x64::sse41>(acc, gpr);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+        emit_init_isa<dnnl::impl::cpu::x64::avx2>(acc, gpr);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+        emit_init_isa<dnnl::impl::cpu::x64::avx512_core>(acc, gpr);
+    } else {
+        IE_THROW() << "Reduce emitter doesn't support " << host_isa_;
+    }
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+void ReduceEmitter::emit_init_isa(size_t acc, size_t gpr) const {
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_acc = Vmm(acc);
+    if (is_max) {
+        // -inf
+        h->mov(Reg32(static_cast<int>(gpr)), 0xff800000);
+        h->uni_vmovd(Xmm(acc), Reg32(static_cast<int>(gpr)));
+        h->uni_vbroadcastss(vmm_acc, Xmm(acc));
+    } else {
+        h->uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+    }
+}
+
+void ReduceEmitter::emit_horizontal(size_t acc, size_t aux_vec) const {
+    if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+        emit_horizontal_isa<dnnl::impl::cpu::x64::sse41>(acc, aux_vec);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+        emit_horizontal_isa<dnnl::impl::cpu::x64::avx2>(acc, aux_vec);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+        emit_horizontal_isa<dnnl::impl::cpu::x64::avx512_core>(acc, aux_vec);
+    } else {
+        IE_THROW() << "Reduce emitter doesn't support " << host_isa_;
+    }
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+void ReduceEmitter::emit_horizontal_isa(size_t acc, size_t aux_vec) const {
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_acc = Vmm(acc);
+    Vmm vmm_aux = Vmm(aux_vec);
+    // every step combines the accumulator with its permutation, so all the lanes end up with the reduced value
+    if (isa == dnnl::impl::cpu::x64::avx512_core) {
+        h->vshuff32x4(Zmm(aux_vec), Zmm(acc), Zmm(acc), 0x4E);
+        emit_op(vmm_acc, vmm_aux);
+        h->vshuff32x4(Zmm(aux_vec), Zmm(acc), Zmm(acc), 0xB1);
+        emit_op(vmm_acc, vmm_aux);
+    } else if (isa == dnnl::impl::cpu::x64::avx2) {
+        h->vperm2f128(Ymm(aux_vec), Ymm(acc), Ymm(acc), 0x01);
+        emit_op(vmm_acc, vmm_aux);
+    }
+    h->uni_vshufps(vmm_aux, vmm_acc, vmm_acc, 0x4E);
+    emit_op(vmm_acc, vmm_aux);
+    h->uni_vshufps(vmm_aux, vmm_acc, vmm_acc, 0xB1);
+    emit_op(vmm_acc, vmm_aux);
+}
+
 MemoryEmitter::MemoryEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
                              const std::shared_ptr<ov::Node>& n) : jit_emitter(h, isa, n) {
     src_prc = InferenceEngine::details::convertPrecision(n->get_input_element_type(0));
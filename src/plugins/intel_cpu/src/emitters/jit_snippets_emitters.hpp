@@ -99,6 +99,8 @@ private:
 /// \brief  TileSchedulerEmitter contains Tiles to be executed (presently vector and scalar). It calculates data offsets
 /// and work amounts, performs data pointer decrements if necessary. It also performs some Tile optimizations: scalar/vector
 /// tiles are emitted only if necessary; Tile body could be emitted directly, if only one Tile evaluation is required.
+/// The body holds pairs of vector and scalar Tiles: the first pair processes the row, the others (if any) are reduction
+/// stages, which are executed over the same row before the first pair.
 ///
 /// \param      in[0]      The number of the node inputs
 /// \param      in[1]      The number of the node outputs
@@ -127,7 +129,7 @@ private:
                    const std::vector<size_t>& gpr,
                    const ov::intel_cpu::emitter_context *emit_context) const override;
 
-    void emit_tiles(const Reg64&, const std::vector<Reg64>&, size_t, const std::vector<size_t>& , const std::vector<size_t>&) const;
+    void emit_tiles(const Reg64&, const std::vector<Reg64>&, size_t, const std::vector<size_t>& , const std::vector<size_t>&, size_t) const;
 
     jit_snippets_compile_args jcp;
 };
@@ -232,6 +234,46 @@ private:
     int32_t value;
 };
 
+///
+/// \brief ReduceEmitter accumulates its input into the accumulator (output) register along the innermost dimension.
+/// The accumulator is initialized by TileSchedulerEmitter before the row stage and reduced horizontally after it,
+/// so that every lane contains the reduced value. Scalar Tiles accumulate only the first lane of the input.
+///
+class ReduceEmitter : public jit_emitter {
+public:
+    ReduceEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n);
+
+    size_t get_inputs_num() const override {return 1;}
+
+    // sets the accumulator to the reduction identity: 0 for sum and -inf for max, gpr is used as a temporary
+    void emit_init(size_t acc, size_t gpr) const;
+    // reduces the accumulator lanes, aux_vec is used as a temporary
+    void emit_horizontal(size_t acc, size_t aux_vec) const;
+
+protected:
+    size_t aux_vecs_count() const override;
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+              const std::vector<size_t>& out,
+              const std::vector<size_t>& pool,
+              const std::vector<size_t>& gpr,
+              const ov::intel_cpu::emitter_context *emit_context) const override;
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_init_isa(size_t acc, size_t gpr) const;
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_horizontal_isa(size_t acc, size_t aux_vec) const;
+    template <typename Vmm>
+    void emit_op(const Vmm& acc, const Vmm& src) const;
+
+private:
+    bool is_max = false;
+    size_t count = 0lu;
+};
+
 ///
 /// Memory emitters:
 ///
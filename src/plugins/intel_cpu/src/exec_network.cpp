@@ -26,12 +26,14 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -64,12 +66,18 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const MultiCachePtr& rtParamsCache,
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const CompiledConstantsCPtr& compiledConstants,
+                         const std::shared_ptr<ov::pass::PassProfiler>& passProfiler) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _network(network) {
+    _network(network),
+    _rtParamsCache(rtParamsCache),
+    _compiledConstants(compiledConstants),
+    _passProfiler(passProfiler) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -118,6 +126,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
+    // Primitives and JIT kernels depend only on the runtime parameters, so the stream graphs compile them once
+    // through the shared cache and each stream keeps only its own memory workspace.
+    if (!_rtParamsCache)
+        _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
     if (_cfg.streamExecutorConfig._streams != 0) {
@@ -137,6 +149,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    _compiledConstants.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -174,12 +187,14 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
         auto makeGraph = [&] {
+            ov::pass::PassProfiler::Scope profilerScope(_passProfiler);
             try {
                 {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
+                graphLock._graph.setCompiledConstants(_compiledConstants);
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _rtParamsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -310,6 +325,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::transformations_profile.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
         };
     }
 
@@ -352,6 +369,15 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::transformations_profile) {
+        std::stringstream profile;
+        if (_passProfiler)
+            _passProfiler->dump_chrome_trace(profile);
+        return decltype(ov::intel_cpu::transformations_profile)::value_type(profile.str());
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        const auto stat = _rtParamsCache->getStatistics();
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"HITS", stat.hits}, {"MISSES", stat.misses}, {"EVICTIONS", stat.evictions}};
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -543,6 +569,8 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+    // the weights reordered for the selected primitives, so the import skips the constant subgraphs
+    serializer << GetGraph()._graph;
 }
 
 }   // namespace intel_cpu
@@ -10,6 +10,7 @@
 #include "graph.h"
 #include "extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <openvino/pass/profiler.hpp>
 
 #include <vector>
 #include <memory>
@@ -36,7 +37,10 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const MultiCachePtr &rtParamsCache,
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const CompiledConstantsCPtr &compiledConstants = nullptr,
+                const std::shared_ptr<ov::pass::PassProfiler> &passProfiler = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -68,6 +72,12 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                           _numaNodesWeights;
+    // runtime parameters cache shared by the graphs of all the streams and, unless it is per network, by the other networks of the plugin
+    MultiCachePtr                               _rtParamsCache;
+    // constants of the imported network, used only while the graphs are created
+    CompiledConstantsCPtr                       _compiledConstants;
+    // profile of the transformations, the graphs of the streams append their own passes
+    std::shared_ptr<ov::pass::PassProfiler>     _passProfiler;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
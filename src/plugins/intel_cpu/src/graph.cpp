@@ -20,6 +20,7 @@
 #include "dnnl_extension_utils.h"
 #include "extension_mngr.h"
 #include "memory_solver.hpp"
+#include <common/primitive_hashing_utils.hpp>
 #include "itt.h"
 #include "infer_request.h"
 #include "nodes/input.h"
@@ -30,6 +31,7 @@
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
+#include "ie_parallel.hpp"
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
@@ -60,6 +62,9 @@ namespace intel_cpu {
 typedef std::unordered_set<EdgePtr> edge_cluster_t;
 typedef std::vector<edge_cluster_t> edge_clusters_t;
 
+// the number of distinct graph input shapes for which the dynamic nodes shapes processing results are kept
+constexpr size_t shapesSnapshotsCapacity = 64;
+
 dnnl::engine Graph::eng(dnnl::engine::kind::cpu, 0);
 
 Graph::~Graph() {
@@ -76,7 +81,7 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = rtCache ? rtCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
 
     Replicate(net, extMgr);
     InitGraph();
@@ -119,9 +124,9 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 }
 
 template void Graph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const MultiCachePtr&);
 template void Graph::CreateGraph(const CNNNetwork&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const MultiCachePtr&);
 
 void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const ExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -396,6 +401,8 @@ void Graph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionLevels();
+
     Allocate();
 
     CreatePrimitives();
@@ -407,6 +414,10 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    if (graphHasDynamicInput && config.rtCacheCapacity != 0) {
+        shapesSnapshots.reset(new LruCache<InputDimsKey, ShapesSnapshotPtr>(shapesSnapshotsCapacity));
+    }
+
     ExecuteConstantNodesOnly();
 }
 
@@ -471,8 +482,18 @@ void Graph::ExtractConstantAndExecutableNodes() {
              * we execute a node, which is not ready to be executed
              */
             executableGraphNodes.emplace_back(graphNode);
+            if (!execLevels.empty()) {
+                const auto level = static_cast<size_t>(execLevels[graphNode->execIndex]);
+                if (executableGraphLevels.size() <= level)
+                    executableGraphLevels.resize(level + 1);
+                executableGraphLevels[level].emplace_back(graphNode);
+            }
         }
     }
+
+    executableGraphLevels.erase(std::remove_if(executableGraphLevels.begin(), executableGraphLevels.end(),
+                                               [](const std::vector<NodePtr>& level) { return level.empty(); }),
+                                executableGraphLevels.end());
 }
 
 void Graph::ExecuteConstantNodesOnly() const {
@@ -504,6 +525,9 @@ void Graph::ExecuteConstantNodesOnly() const {
     };
 
     for (const auto &node : constantGraphNodes) {
+        // the outputs are imported
+        if (restoredConstantNodes.count(node.get()))
+            continue;
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
@@ -519,6 +543,27 @@ void Graph::ExecuteConstantNodesOnly() const {
     }
 }
 
+bool Graph::CanRestoreCompiledConstants(const NodePtr& node) const {
+    if (!node->isConstant() || node->getType() == Type::Input || node->getChildEdges().empty())
+        return false;
+
+    for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+        auto edgePtr = node->getChildEdgeAt(i);
+        // the views of the other edges are not exported
+        if (edgePtr->getStatus() != Edge::Status::NeedAllocation)
+            return false;
+        auto constant = compiledConstants->find(edgePtr->name());
+        if (constant == compiledConstants->end())
+            return false;
+        // layouts depend on the ISA, so the constants are used only if the same ones are selected
+        const auto& desc = edgePtr->getDesc();
+        if (!desc.isDefined() || constant->second.size != desc.getCurrentMemSize() ||
+            constant->second.desc != MemoryDescUtils::convertToDnnlMemoryDesc(desc.clone())->getDnnlDesc())
+            return false;
+    }
+    return true;
+}
+
 static bool isReorderAvailable(const MemoryDescPtr& parentDesc, const MemoryDescPtr& childDesc, const dnnl::engine& eng) {
     auto definedParentDesc = parentDesc->isDefined() ? parentDesc : MemoryDescUtils::makeDummyDesc(*parentDesc);
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(definedParentDesc)->getDnnlDesc();
@@ -609,6 +654,46 @@ void Graph::InitEdges() {
     }
 }
 
+/**
+ * Splits the graph into wavefronts: a node gets the level following the deepest of its producers, so
+ * nodes of the same level never depend on each other and may run concurrently. The levels are also used
+ * as timestamps for the memory solver in place of execIndex. That keeps the buffer reuse correct, because
+ * all nodes of one level finish before the next level starts.
+ */
+void Graph::InitExecutionLevels() {
+    execLevels.clear();
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return;
+
+    // Dynamic nodes share the runtime parameters cache, which is not thread safe, and ReadValue/Assign pairs
+    // are ordered by execIndex only (there is no edge between them), so such graphs are executed sequentially.
+    const bool unsupported = std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    });
+    if (unsupported)
+        return;
+
+    execLevels.resize(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            level = std::max(level, execLevels[parent->execIndex] + 1);
+        }
+        execLevels[node->execIndex] = level;
+    }
+#endif
+}
+
+int Graph::getExecTimestamp(const NodePtr& node) const {
+    return execLevels.empty() ? node->execIndex : execLevels[node->execIndex];
+}
+
 static inline bool isConstOutput(EdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
@@ -663,6 +748,15 @@ void Graph::AllocateWithReuse() {
 
     size_t edge_clusters_count = edge_clusters.size();
 
+    // the constant nodes with the imported outputs are not executed, their edges use the imported data in place
+    restoredConstantNodes.clear();
+    if (compiledConstants) {
+        for (const auto& node : graphNodes) {
+            if (CanRestoreCompiledConstants(node))
+                restoredConstantNodes.insert(node.get());
+        }
+    }
+
     for (size_t i = 0; i < edge_clusters_count;) {
         auto &cluster = edge_clusters[i];
         bool erase = false;
@@ -672,6 +766,8 @@ void Graph::AllocateWithReuse() {
                 if (edge->getParent()->getType() == Type::Input) {
                     auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<Memory>(constNode->getMemoryPtr()));
+                } else if (restoredConstantNodes.count(edge->getParent().get())) {
+                    edge->allocate(compiledConstants->at(edge->name()).data.get());
                 } else {
                     edge->externalAllocate(weightsCache);
                 }
@@ -693,12 +789,13 @@ void Graph::AllocateWithReuse() {
 
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
+    std::vector<MemorySolver::Box> arenaBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = getExecTimestamp(edge->getParent());
+            int e_finish = getExecTimestamp(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -734,9 +831,13 @@ void Graph::AllocateWithReuse() {
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
             definedBoxes.push_back(box);
-        } else {
+        } else if (isInput || isOutput) {
+            // the I/O tensors may be replaced with the user memory, so they are kept out of the arena
             box.size = boxSize;
             undefinedBoxes.push_back(box);
+        } else {
+            box.size = boxSize;
+            arenaBoxes.push_back(box);
         }
     }
 
@@ -805,6 +906,19 @@ void Graph::AllocateWithReuse() {
             }
         }
     }
+
+    dynamicArena.reset();
+    if (!arenaBoxes.empty()) {
+        dynamicArena = std::make_shared<DynamicMemoryArena>();
+        for (auto& box : arenaBoxes) {
+            auto boxMemMngr = dynamicArena->addBox(box);
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    edge->allocate(boxMemMngr);
+                }
+            }
+        }
+    }
 }
 
 void Graph::Allocate() {
@@ -984,12 +1098,12 @@ void Graph::PullOutputData(BlobMap &out) {
     }
 }
 
-inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
+inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream, Node::ShapesRecord* record) const {
     DUMP(node, config, infer_count);
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
 
     if (node->isDynamicNode()) {
-        node->executeDynamic(stream);
+        node->executeDynamic(stream, record);
     } else {
         node->execute(stream);
     }
@@ -1001,18 +1115,99 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    dnnl::stream stream(eng);
+    const auto snapshot = GetShapesSnapshot();
+
+    if (!executableGraphLevels.empty()) {
+        InferParallelBranches(request, snapshot.get());
+    } else {
+        dnnl::stream stream(eng);
+
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream, snapshot ? &(*snapshot)[node->getExecIndex()] : nullptr);
+        }
+    }
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    // the intermediate tensors are consumed at this point, so the dynamic ones may be repacked for the next inference
+    if (dynamicArena)
+        dynamicArena->solve();
 
+    if (infer_count != -1) infer_count++;
+}
+
+void Graph::InferParallelBranches(InferRequestBase* request, ShapesSnapshot* snapshot) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // the nodes of a level write their own records only
+    auto executeRange = [this, snapshot](const std::vector<NodePtr>& level, size_t begin, size_t end) {
+        dnnl::stream stream(eng);
+        for (size_t i = begin; i < end; i++) {
+            const auto& node = level[i];
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream, snapshot ? &(*snapshot)[node->getExecIndex()] : nullptr);
+        }
+    };
+
+    for (const auto& level : executableGraphLevels) {
         if (request)
             request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+
+        if (level.size() == 1) {
+            executeRange(level, 0, 1);
+            continue;
+        }
+
+        // nested parallel regions of the nodes are balanced by the TBB work stealing scheduler
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, level.size(), 1), [&](const tbb::blocked_range<size_t>& range) {
+            executeRange(level, range.begin(), range.end());
+        });
     }
+#else
+    IE_THROW() << "Parallel branches execution is supported only with TBB threading";
+#endif
+}
 
-    if (infer_count != -1) infer_count++;
+size_t Graph::InputDimsKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& d : dims)
+        seed = get_vector_hash(seed, d);
+    return seed;
+}
+
+bool Graph::InputDimsKey::operator==(const InputDimsKey& rhs) const {
+    return dims == rhs.dims;
+}
+
+Graph::ShapesSnapshotPtr Graph::GetShapesSnapshot() {
+    if (!shapesSnapshots)
+        return nullptr;
+
+    InputDimsKey key;
+    key.dims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& childEdges = input.second->getChildEdges();
+        if (childEdges.empty())
+            continue;
+        const auto& desc = input.second->getChildEdgeAt(0)->getMemory().getDesc();
+        if (!desc.isDefined())
+            return nullptr;
+        key.dims.push_back(desc.getShape().getStaticDims());
+    }
+
+    auto snapshot = shapesSnapshots->get(key);
+    if (!snapshot) {
+        // the records are filled by the nodes during the inference
+        snapshot = std::make_shared<ShapesSnapshot>(graphNodes.size());
+        shapesSnapshots->put(key, snapshot);
+    }
+    return snapshot;
 }
 
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
@@ -1109,8 +1304,12 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
         pc.execution_index = i++;
         // TODO: Why time counter is signed?
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
-        pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
-                                    : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        if (pc.cpu_uSec > 0)
+            pc.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+        else if (!node->isExecutable() && !node->isDynamicNode())
+            pc.status = InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT;
+        else
+            pc.status = InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
@@ -1137,6 +1336,10 @@ void Graph::setConfig(const Config &cfg) {
     config = cfg;
 }
 
+void Graph::setCompiledConstants(CompiledConstantsCPtr constants) {
+    compiledConstants = std::move(constants);
+}
+
 const Config& Graph::getConfig() const {
     return config;
 }
@@ -1418,8 +1621,8 @@ void Graph::EnforceBF16() {
                 if (!(parent->getType() == Type::Input && parent->isConstant() &&
                     // Concatenation node is exception because it doesn't change an accuracy for BF16 activation
                       node->getType() != Type::Concatenation) &&
-                    // exclude Eltwise after Input since it supports conversion to BF16
-                    !(parent->getType() == Type::Input && node->getType() == Type::Eltwise) &&
+                    // exclude Eltwise and Preprocess after Input since they support conversion to BF16
+                    !(parent->getType() == Type::Input && one_of(node->getType(), Type::Eltwise, Type::Preprocess)) &&
                     node->getOriginalInputPrecisionAtPort(i) == Precision::FP32)
                     node->setOriginalInputPrecisionAtPort(i, Precision::BF16);
             }
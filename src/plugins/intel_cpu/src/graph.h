@@ -7,15 +7,19 @@
 #include "cpp/ie_cnn_network.h"
 #include "config.h"
 #include "cpu_memory.h"
+#include "memory_arena.h"
 #include "normalize_preprocess.h"
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
+#include "serialize.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_set>
 
 namespace ov {
 namespace intel_cpu {
@@ -47,13 +51,25 @@ public:
     void setConfig(const Config &cfg);
     const Config& getConfig() const;
 
+    /**
+     * @param constants compiled constants of an imported network. The edges of the constant subgraph outputs found
+     * there point to the imported data instead of being computed, so the graph keeps the constants.
+     */
+    void setCompiledConstants(CompiledConstantsCPtr constants);
+
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @param rtCache runtime parameters cache shared with the graphs of the other streams,
+     * so the primitives and JIT kernels compiled by one stream are reused by the others.
+     * A private cache is created if it is not provided.
+     */
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
-                     WeightsSharing::Ptr &w_cache);
+                     WeightsSharing::Ptr &w_cache,
+                     const MultiCachePtr& rtCache = nullptr);
 
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
@@ -207,6 +223,9 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        execLevels.clear();
+        executableGraphLevels.clear();
+        shapesSnapshots.reset();
         _normalizePreprocMap.clear();
     }
     Status status { NotReady };
@@ -219,6 +238,10 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    // common storage for the intermediate tensors with undefined size
+    DynamicMemoryArena::Ptr dynamicArena;
+    CompiledConstantsCPtr compiledConstants;
+    std::unordered_set<const Node*> restoredConstantNodes;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -238,12 +261,16 @@ protected:
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitExecutionLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
-    void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
+    void ExecuteNode(const NodePtr& node, const dnnl::stream& stream, Node::ShapesRecord* record = nullptr) const;
+    void InferParallelBranches(InferRequestBase* request, std::vector<Node::ShapesRecord>* snapshot);
+    int getExecTimestamp(const NodePtr& node) const;
     void ExecuteConstantNodesOnly() const;
+    bool CanRestoreCompiledConstants(const NodePtr& node) const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -261,8 +288,29 @@ private:
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
 
+    // Wavefront schedule used when independent branches are executed concurrently (see InitExecutionLevels).
+    // execLevels is indexed by Node::execIndex, executableGraphLevels groups executableGraphNodes by level.
+    // Both are empty when the graph is executed sequentially.
+    std::vector<int> execLevels;
+    std::vector<std::vector<NodePtr>> executableGraphLevels;
+
     MultiCachePtr rtParamsCache;
 
+    // Shapes processing results of the dynamic nodes (indexed by Node::execIndex) per the graph input dims,
+    // so the repeated input shapes skip the shape inference and the parameters preparation of the whole graph.
+    // Empty for the static graphs
+    struct InputDimsKey {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const InputDimsKey& rhs) const;
+    };
+    using ShapesSnapshot = std::vector<Node::ShapesRecord>;
+    using ShapesSnapshotPtr = std::shared_ptr<ShapesSnapshot>;
+    std::unique_ptr<LruCache<InputDimsKey, ShapesSnapshotPtr>> shapesSnapshots;
+
+    ShapesSnapshotPtr GetShapesSnapshot();
+
     void EnforceBF16();
 };
 
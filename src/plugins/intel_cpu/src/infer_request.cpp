@@ -56,7 +56,9 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            auto state = std::make_shared<VariableState>(state_name, state_store);
+            variableStates[memoryNode->getId()] = state;
+            memoryStates.emplace_back(state);
         }
     }
 }
@@ -93,46 +95,32 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
 }
 
 void InferRequestBase::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+    // The request may run on the graph of any stream, so the binding is refreshed when the graph changes
+    if (statesGraph != graph) {
+        boundStates.clear();
+        for (auto &node : graph->GetNodes()) {
+            if (node->getType() == Type::MemoryInput) {
+                auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+                if (!cur_node) {
+                    IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
                 }
+                auto state = variableStates.find(cur_node->getId());
+                if (state != variableStates.end())
+                    boundStates.push_back({cur_node, state->second, false});
             }
         }
+        statesGraph = graph;
+    }
+
+    for (auto &bound : boundStates) {
+        bound.swap = bound.node->bindState(bound.state->currentBuffer(), bound.state->nextBuffer());
     }
 }
 
 void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
+    for (auto &bound : boundStates) {
+        if (bound.swap)
+            bound.state->swapBuffers();
     }
 }
 
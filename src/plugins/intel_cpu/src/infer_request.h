@@ -5,9 +5,12 @@
 #pragma once
 
 #include "graph.h"
+#include "memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 
 namespace ov {
@@ -15,6 +18,9 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+namespace node {
+class MemoryInput;
+}   // namespace node
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -67,6 +73,15 @@ private:
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    std::unordered_map<std::string, std::shared_ptr<VariableState>> variableStates;
+
+    struct BoundState {
+        node::MemoryInput* node;
+        std::shared_ptr<VariableState> state;
+        bool swap;
+    };
+    std::vector<BoundState> boundStates;
+    const Graph* statesGraph = nullptr;
     AsyncInferRequest*                  _asyncRequest = nullptr;
 };
 
@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_arena.h"
+
+#include <algorithm>
+#include <common/utils.hpp>
+#include "utils/general_utils.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr int cacheLineSize = 64;
+constexpr int64_t alignment = 32;  // 32 bytes, the same as for the static memory solver
+}   // namespace
+
+/**
+ * @brief Memory manager of one arena box. It points into the arena buffer or, if the box has outgrown its slot,
+ * to a private buffer. An externally provided buffer detaches the manager from the arena for good.
+ */
+class DynamicMemoryArena::SlotMemoryMngr : public IMemoryMngr {
+public:
+    explicit SlotMemoryMngr(std::shared_ptr<std::atomic<bool>> outgrown)
+        : _outgrown(std::move(outgrown)), _ownData(nullptr, release) {}
+
+    void* getRawPtr() const noexcept override {
+        return _data;
+    }
+
+    void setExtBuff(void* ptr, size_t size) override {
+        _useExternalStorage = true;
+        _detached = true;
+        _data = ptr;
+        _memUpperBound = size;
+        _ownData.reset();
+    }
+
+    bool resize(size_t size) override {
+        _highWaterMark = std::max(_highWaterMark, size);
+        if (size <= _memUpperBound) {
+            return false;
+        }
+        void* ptr = dnnl::impl::malloc(size, cacheLineSize);
+        if (!ptr) {
+            throw std::bad_alloc();
+        }
+        _ownData = decltype(_ownData)(ptr, destroy);
+        _data = ptr;
+        _memUpperBound = size;
+        _useExternalStorage = false;
+        if (!_detached) {
+            _outgrown->store(true);
+        }
+        return true;
+    }
+
+    bool hasExtBuffer() const noexcept override {
+        return _useExternalStorage;
+    }
+
+    void bind(void* ptr) {
+        _ownData.reset();
+        _data = ptr;
+        _memUpperBound = _highWaterMark;
+    }
+
+    size_t getHighWaterMark() const noexcept {
+        return _highWaterMark;
+    }
+
+    bool isDetached() const noexcept {
+        return _detached;
+    }
+
+private:
+    static void destroy(void* ptr) {
+        dnnl::impl::free(ptr);
+    }
+
+    // shared with the arena, so the manager which outlives the arena does not write to the freed memory
+    std::shared_ptr<std::atomic<bool>> _outgrown;
+    bool _useExternalStorage = false;
+    bool _detached = false;
+    void* _data = nullptr;
+    size_t _memUpperBound = 0ul;
+    size_t _highWaterMark = 0ul;
+    std::unique_ptr<void, void (*)(void*)> _ownData;
+};
+
+void DynamicMemoryArena::release(void* ptr) {
+    dnnl::impl::free(ptr);
+}
+
+DnnlMemoryMngrPtr DynamicMemoryArena::addBox(const MemorySolver::Box& box) {
+    auto slotMngr = new SlotMemoryMngr(_outgrown);
+    auto mngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<IMemoryMngr>(slotMngr));
+    _slots.push_back({box, slotMngr, mngr});
+    return mngr;
+}
+
+bool DynamicMemoryArena::solve() {
+    if (!_outgrown->exchange(false))
+        return false;
+
+    std::vector<MemorySolver::Box> boxes;
+    for (size_t i = 0; i < _slots.size(); i++) {
+        const auto& slot = _slots[i];
+        if (slot.impl->isDetached() || slot.impl->getHighWaterMark() == 0)
+            continue;
+        auto box = slot.box;
+        box.size = div_up(static_cast<int64_t>(slot.impl->getHighWaterMark()), alignment);
+        box.id = static_cast<int64_t>(i);
+        boxes.push_back(box);
+    }
+
+    if (boxes.empty())
+        return false;
+
+    MemorySolver solver(boxes);
+    const size_t totalSize = static_cast<size_t>(solver.solve()) * alignment;
+
+    decltype(_buffer) buffer(dnnl::impl::malloc(totalSize, cacheLineSize), release);
+    if (!buffer) {
+        throw std::bad_alloc();
+    }
+
+    auto* basePtr = static_cast<int8_t*>(buffer.get());
+    for (const auto& box : boxes) {
+        auto& slot = _slots[box.id];
+        slot.impl->bind(basePtr + solver.getOffset(box.id) * alignment);
+        slot.mngr->notifyUpdate();
+    }
+    _buffer = std::move(buffer);
+
+    return true;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
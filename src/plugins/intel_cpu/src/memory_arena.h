@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "memory_solver.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Common storage for the intermediate tensors of a graph whose sizes are unknown until the inference time.
+ *
+ * Each registered box gets a memory manager served from a slot of one common buffer. The slot offsets are
+ * calculated by MemorySolver from the box live times and the largest size ever requested for the box
+ * (high-water mark). A box that outgrows its slot falls back to a private buffer until the next solve() call,
+ * which repacks all the boxes into a new common buffer. So after a few inferences the arena converges to a
+ * single allocation of the same size as the static memory solver would produce for the peak shapes.
+ */
+class DynamicMemoryArena {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryArena>;
+
+    DynamicMemoryArena() : _buffer(nullptr, release), _outgrown(std::make_shared<std::atomic<bool>>(false)) {}
+
+    /**
+     * @brief Registers the box in the arena.
+     * @param box memory solver box, only the live time is taken into account
+     * @return the memory manager that must be used by all the edges of the box
+     */
+    DnnlMemoryMngrPtr addBox(const MemorySolver::Box& box);
+
+    /**
+     * @brief Repacks the boxes into a new common buffer if any of them outgrew its slot since the previous call.
+     * Must be called only when the managed tensors don't hold data that is still needed, i.e. between inferences.
+     * @return status whether the boxes were repacked
+     */
+    bool solve();
+
+private:
+    class SlotMemoryMngr;
+
+    struct Slot {
+        MemorySolver::Box box;
+        SlotMemoryMngr* impl;
+        DnnlMemoryMngrPtr mngr;
+    };
+
+    static void release(void* ptr);
+
+    std::vector<Slot> _slots;
+    std::unique_ptr<void, void (*)(void*)> _buffer;
+    std::shared_ptr<std::atomic<bool>> _outgrown;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -11,10 +11,36 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name} {
+    for (auto& buffer : buffers) {
+        buffer = std::make_shared<Memory>(storage->getEngine());
+        buffer->Create(storage->getDesc());
+    }
+    cpu_memcpy(currentBuffer()->GetData(), storage->GetData(), storage->GetSize());
+
+    state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
+    state->allocate();
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(currentBuffer()->GetData(), 0, currentBuffer()->GetSize());
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (!newState)
+        IE_THROW(NotAllocated) << "Variable state " << name << " can't be set to an empty blob";
+    if (newState->byteSize() != currentBuffer()->GetSize())
+        IE_THROW() << "Variable state " << name << " expects " << currentBuffer()->GetSize()
+                   << " bytes, but the new state has " << newState->byteSize();
+
+    cpu_memcpy(currentBuffer()->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    cpu_memcpy(state->buffer(), currentBuffer()->GetData(), state->byteSize());
+    return state;
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
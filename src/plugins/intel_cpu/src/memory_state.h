@@ -10,21 +10,38 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Variable state kept as a pair of ping-pong buffers.
+ * ReadValue reads the current buffer while Assign writes the next one, and the buffers are swapped
+ * after the inference, so the state is only copied when the user calls GetState/SetState.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    VariableState(std::string name, MemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const MemoryPtr& currentBuffer() const {
+        return buffers[current];
+    }
+    const MemoryPtr& nextBuffer() const {
+        return buffers[current ^ 1];
+    }
+    void swapBuffers() {
+        current ^= 1;
+    }
+
+private:
+    std::array<MemoryPtr, 2> buffers;
+    size_t current = 0;
 };
 
 }   // namespace intel_cpu
@@ -159,14 +159,14 @@ ov::intel_cpu::MHAFloatFusion::MHAFloatFusion() {
 ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
     MATCHER_SCOPE(MHAFloatFusion2);
 
-    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
-    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
-    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in4 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in5 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in6 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in7 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
-    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in9 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in10 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto transpose0 = std::make_shared<ngraph::opset3::Transpose>(in0, in4);
@@ -185,16 +185,20 @@ ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
         auto add_in1 = pattern_to_output.at(in3);
         auto transpose2_in = pattern_to_output.at(in8);
 
-        if (transpose0_in.get_shape() != transpose1_in.get_shape() || transpose0_in.get_shape() != transpose2_in.get_shape()) {
+        // batch and sequence dimensions may be dynamic
+        const auto& transpose0_shape = transpose0_in.get_partial_shape();
+        const auto& transpose1_shape = transpose1_in.get_partial_shape();
+        if (!transpose0_shape.compatible(transpose1_shape) || !transpose0_shape.compatible(transpose2_in.get_partial_shape())) {
             return false;
         }
 
-        if (transpose0_in.get_shape().size() != 4) {
+        if (transpose0_shape.size() != 4 || transpose0_shape[2].is_dynamic() || transpose0_shape[3].is_dynamic()) {
             return false;
         }
 
-        auto expected_add_shape = Shape({transpose0_in.get_shape()[0], 1, 1, transpose0_in.get_shape()[1]});
-        if (add_in1.get_shape() != expected_add_shape) {
+        const auto& add_shape = add_in1.get_partial_shape();
+        auto expected_add_shape = ov::PartialShape({transpose0_shape[0], 1, 1, transpose1_shape[1]});
+        if (add_shape.size() != 4 || add_shape[1] != 1 || add_shape[2] != 1 || !add_shape.compatible(expected_add_shape)) {
             return false;
         }
 
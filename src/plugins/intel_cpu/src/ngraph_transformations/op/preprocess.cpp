@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::PreprocessNode::PreprocessNode(const ngraph::Output<ngraph::Node> &data,
+                                              const std::vector<float> &scales,
+                                              const std::vector<float> &shifts,
+                                              bool channels_last_input,
+                                              const ngraph::element::Type output_type)
+    : Op({data}), m_scales(scales), m_shifts(shifts), m_channels_last_input(channels_last_input), m_output_type(output_type) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::PreprocessNode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    INTERNAL_OP_SCOPE(PreprocessNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::PreprocessNode>(new_args.at(0), m_scales, m_shifts, m_channels_last_input, m_output_type);
+}
+
+void ov::intel_cpu::PreprocessNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(PreprocessNode_validate_and_infer_types);
+    const auto& input_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, input_shape.rank().compatible(4), "Preprocess supports 4D input only, got: ", input_shape);
+    NODE_VALIDATION_CHECK(this, m_scales.size() == m_shifts.size(), "Scales and shifts must have the same size");
+
+    auto output_shape = input_shape;
+    if (m_channels_last_input && input_shape.rank().is_static()) {
+        output_shape = {input_shape[0], input_shape[3], input_shape[1], input_shape[2]};
+    }
+    if (output_shape.rank().is_static()) {
+        const auto& channels = output_shape[1];
+        NODE_VALIDATION_CHECK(this, channels.is_static() && static_cast<size_t>(channels.get_length()) == m_scales.size(),
+                              "Channels dimension must be static and match the number of scales: ", output_shape);
+    }
+    set_output_type(0, m_output_type, output_shape);
+}
+
+bool ov::intel_cpu::PreprocessNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(PreprocessNode_visit_attributes);
+    visitor.on_attribute("scales", m_scales);
+    visitor.on_attribute("shifts", m_shifts);
+    visitor.on_attribute("channels_last_input", m_channels_last_input);
+    visitor.on_attribute("out-type", m_output_type);
+    return true;
+}
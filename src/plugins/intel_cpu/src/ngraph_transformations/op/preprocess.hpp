@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Fused input preprocessing: per-channel y = x * scale + shift with the conversion to the output type and
+ * optional NHWC -> NCHW layout conversion. Replaces the Convert/Subtract/Multiply/Divide/Transpose chains created
+ * by PrePostProcessor at the model inputs.
+ */
+class PreprocessNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Preprocess", "cpu_plugin_opset");
+
+    PreprocessNode() = default;
+
+    PreprocessNode(const ngraph::Output<ngraph::Node> &data,
+                   const std::vector<float> &scales,
+                   const std::vector<float> &shifts,
+                   bool channels_last_input,
+                   const ngraph::element::Type output_type);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const std::vector<float>& get_scales() const { return m_scales; }
+    const std::vector<float>& get_shifts() const { return m_shifts; }
+    bool is_channels_last_input() const { return m_channels_last_input; }
+    ngraph::element::Type get_output_type() const { return m_output_type; }
+
+private:
+    std::vector<float> m_scales;
+    std::vector<float> m_shifts;
+    bool m_channels_last_input = false;
+    ngraph::element::Type m_output_type;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
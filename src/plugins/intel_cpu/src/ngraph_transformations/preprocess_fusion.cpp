@@ -0,0 +1,165 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "preprocess_fusion.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include "op/preprocess.hpp"
+#include "utils/general_utils.h"
+
+#include "itt.hpp"
+
+using namespace ngraph;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+bool isPreprocessSource(const std::shared_ptr<Node>& node) {
+    return ov::is_type<opset1::Parameter>(node) ||
+           ov::is_type<ov::opset8::NV12toRGB>(node) || ov::is_type<ov::opset8::NV12toBGR>(node) ||
+           ov::is_type<ov::opset8::I420toRGB>(node) || ov::is_type<ov::opset8::I420toBGR>(node);
+}
+
+bool isArithmetic(const std::shared_ptr<Node>& node) {
+    return ov::is_type<opset1::Subtract>(node) || ov::is_type<opset1::Add>(node) ||
+           ov::is_type<opset1::Multiply>(node) || ov::is_type<opset1::Divide>(node);
+}
+
+std::shared_ptr<opset1::Constant> getArithmeticConstant(const std::shared_ptr<Node>& node, const Output<Node>& data) {
+    if (node->input_value(0) == data) {
+        return ov::as_type_ptr<opset1::Constant>(node->get_input_node_shared_ptr(1));
+    }
+    // x - c and x / c only, the constant may be the first input of the commutative operations
+    if (ov::is_type<opset1::Add>(node) || ov::is_type<opset1::Multiply>(node)) {
+        return ov::as_type_ptr<opset1::Constant>(node->get_input_node_shared_ptr(0));
+    }
+    return nullptr;
+}
+
+// Returns the per-channel values of the constant or empty vector if it isn't broadcasted along all other axes
+std::vector<float> getChannelValues(const std::shared_ptr<opset1::Constant>& constant, size_t channelAxis, size_t channels, size_t rank) {
+    const auto& shape = constant->get_shape();
+    if (shape.size() > rank)
+        return {};
+    const auto offset = rank - shape.size();
+    for (size_t i = 0; i < shape.size(); i++) {
+        if (shape[i] != 1 && (i + offset != channelAxis || shape[i] != channels))
+            return {};
+    }
+    auto values = constant->cast_vector<float>();
+    if (values.size() == 1)
+        values.resize(channels, values[0]);
+    return values;
+}
+
+bool fuseChain(const Input<Node>& first) {
+    const auto source = first.get_source_output();
+    const auto& sourceShape = source.get_partial_shape();
+    const auto& sourceType = source.get_element_type();
+    if (sourceShape.rank().is_dynamic() || sourceShape.size() != 4 ||
+        !one_of(sourceType, element::u8, element::i8, element::f32))
+        return false;
+
+    // collect the supported operations, every intermediate result must have the only consumer
+    std::vector<std::shared_ptr<Node>> chain;
+    auto type = sourceType;
+    bool withConvert = false, withTranspose = false;
+    auto node = first.get_node()->shared_from_this();
+    while (true) {
+        if (auto convert = ov::as_type_ptr<opset1::Convert>(node)) {
+            if (withConvert || convert->get_destination_type() != element::f32)
+                break;
+            withConvert = true;
+        } else if (auto transpose = ov::as_type_ptr<opset1::Transpose>(node)) {
+            auto order = ov::as_type_ptr<opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+            if (withTranspose || !order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2})
+                break;
+            withTranspose = true;
+        } else if (isArithmetic(node)) {
+            const auto data = chain.empty() ? source : chain.back()->output(0);
+            if (type != element::f32 || node->get_output_partial_shape(0) != data.get_partial_shape() ||
+                !getArithmeticConstant(node, data))
+                break;
+        } else {
+            break;
+        }
+        type = node->get_output_element_type(0);
+        chain.push_back(node);
+
+        const auto consumers = node->get_output_target_inputs(0);
+        if (consumers.size() != 1)
+            break;
+        node = consumers.begin()->get_node()->shared_from_this();
+    }
+
+    // the result must be f32, the channels must be the second output axis
+    while (!chain.empty() && chain.back()->get_output_element_type(0) != element::f32)
+        chain.pop_back();
+    withTranspose = std::any_of(chain.begin(), chain.end(), [](const std::shared_ptr<Node>& n) {
+        return ov::is_type<opset1::Transpose>(n);
+    });
+    if (chain.size() < 2)
+        return false;
+
+    const size_t rank = 4;
+    size_t channelAxis = withTranspose ? 3 : 1;
+    const auto& channelsDim = sourceShape[channelAxis];
+    if (channelsDim.is_dynamic())
+        return false;
+    const auto channels = static_cast<size_t>(channelsDim.get_length());
+
+    std::vector<float> scales(channels, 1.f), shifts(channels, 0.f);
+    auto data = source;
+    for (const auto& op : chain) {
+        if (ov::is_type<opset1::Transpose>(op)) {
+            channelAxis = 1;
+        } else if (isArithmetic(op)) {
+            const auto values = getChannelValues(getArithmeticConstant(op, data), channelAxis, channels, rank);
+            if (values.empty())
+                return false;
+            for (size_t c = 0; c < channels; c++) {
+                if (ov::is_type<opset1::Subtract>(op)) {
+                    shifts[c] -= values[c];
+                } else if (ov::is_type<opset1::Add>(op)) {
+                    shifts[c] += values[c];
+                } else if (ov::is_type<opset1::Multiply>(op)) {
+                    scales[c] *= values[c];
+                    shifts[c] *= values[c];
+                } else {
+                    scales[c] /= values[c];
+                    shifts[c] /= values[c];
+                }
+            }
+        }
+        data = op->output(0);
+    }
+
+    const auto& last = chain.back();
+    auto preprocess = std::make_shared<PreprocessNode>(source, scales, shifts, withTranspose, element::f32);
+    preprocess->set_friendly_name(last->get_friendly_name());
+    ngraph::copy_runtime_info(NodeVector(chain.begin(), chain.end()), preprocess);
+    ngraph::replace_node(last, preprocess);
+    return true;
+}
+}   // namespace
+
+bool PreprocessFusion::run_on_model(const std::shared_ptr<ov::Model> &m) {
+    RUN_ON_MODEL_SCOPE(PreprocessFusion);
+    bool rewritten = false;
+    for (const auto& node : m->get_ordered_ops()) {
+        if (!isPreprocessSource(node))
+            continue;
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs())
+                rewritten |= fuseChain(input);
+        }
+    }
+    return rewritten;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @interface PreprocessFusion
+ * @brief Fuses the chains of Convert, per-channel Subtract/Add/Multiply/Divide by constants and NHWC -> NCHW Transpose
+ * which start at the model inputs (or color conversion nodes) into a single PreprocessNode
+ */
+class PreprocessFusion : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("PreprocessFusion", "0");
+    PreprocessFusion() : ModelPass() {}
+    bool run_on_model(const std::shared_ptr<ov::Model> &) override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
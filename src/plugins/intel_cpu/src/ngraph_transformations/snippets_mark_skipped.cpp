@@ -152,7 +152,8 @@ int getChannelAxis(const ov::AxisSet &axes, bool keep_dims) {
 }
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node, int &channelAxis) {
     const bool is_suitable_node = ov::is_type<ngraph::op::v0::MVN>(node) ||
-                                  ov::is_type<ngraph::op::v6::MVN>(node) ||
+                                  // innermost-axis MVN is decomposed by snippets, so the whole LayerNorm block is a single kernel
+                                  (ov::is_type<ngraph::op::v6::MVN>(node) && !snippets::pass::AppropriateForSubgraph(node)) ||
                                   ov::is_type<ngraph::op::v0::NormalizeL2>(node) ||
                                   ov::is_type<ngraph::op::v0::Interpolate>(node) ||
                                   ov::is_type<ngraph::op::v4::Interpolate>(node) ||
@@ -517,21 +517,46 @@ void Node::execute(dnnl::stream strm) {
     }
 }
 
-void Node::executeDynamic(dnnl::stream strm) {
+void Node::executeDynamic(dnnl::stream strm, ShapesRecord* record) {
+    // the record is reused only if it was made for the same input dims, otherwise it is overwritten
+    const bool reuseRecord = record && inputDimsEqual(record->inputDims);
+    bool outputDimsRecorded = false;
     if (needShapeInfer()) {
-        redefineOutputMemory(shapeInfer());
+        if (reuseRecord && !record->outputDims.empty()) {
+            redefineOutputMemory(record->outputDims);
+        } else {
+            auto newOutputShapes = shapeInfer();
+            redefineOutputMemory(newOutputShapes);
+            if (record && isShapeInferReusable()) {
+                record->outputDims = std::move(newOutputShapes);
+                outputDimsRecorded = true;
+            }
+        }
     }
     if (isExecutable()) {
         if (needPrepareParams()) {
             IE_ASSERT(inputShapesDefined()) << "Can't prepare params for " << getTypeStr() << " node with name: " << getName() <<
                 " since the input shapes are not defined.";
-            DEBUG_LOG(" prepareParams() on #", getExecIndex(), " ", getTypeStr(), " ", algToString(getAlgorithm()),
-                      " ", getName(), " ", getOriginalLayers());
-            prepareParams();
+            if (reuseRecord && record->preparedState) {
+                restorePreparedState(record->preparedState);
+            } else {
+                DEBUG_LOG(" prepareParams() on #", getExecIndex(), " ", getTypeStr(), " ", algToString(getAlgorithm()),
+                          " ", getName(), " ", getOriginalLayers());
+                prepareParams();
+            }
         }
         executeDynamicImpl(strm);
     }
     updateLastInputDims();
+
+    if (record && !reuseRecord) {
+        record->inputDims = lastInputDims;
+        // if the shape inference was skipped since the input dims were not changed, the output dims are recorded
+        // next time it is performed for these input dims
+        if (!outputDimsRecorded)
+            record->outputDims.clear();
+        record->preparedState = isExecutable() ? getPreparedState() : nullptr;
+    }
 }
 
 void Node::redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes) {
@@ -1472,6 +1497,25 @@ bool Node::needShapeInfer() const {
     return inputShapesModified();
 }
 
+bool Node::inputDimsEqual(const std::vector<VectorDims>& dims) const {
+    if (dims.size() != getParentEdges().size())
+        return false;
+
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] != getParentEdgesAtPort(i)[0]->getMemory().getStaticDims())
+            return false;
+    }
+    return true;
+}
+
+bool Node::hasNonConstInputs(uint32_t portMask) const {
+    for (size_t port = 0; port < getParentEdges().size(); port++) {
+        if ((portMask & (1 << port)) && !getParentEdgesAtPort(port)[0]->getParent()->isConstant())
+            return true;
+    }
+    return false;
+}
+
 std::vector<VectorDims> Node::shapeInfer() const {
     return shapeInferGeneric();
 }
@@ -1481,6 +1525,8 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>&
     // collect input values
     std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> input_values;
     if (input_value_port_mask) {
+        if (!shapeInferDataDependent)
+            shapeInferDataDependent = hasNonConstInputs(input_value_port_mask);
         const auto & iranks = shapeInference->get_input_ranks();
         for (size_t port = 0; port < iranks.size(); port++) {
             if (input_value_port_mask & (1 << port)) {
@@ -1502,38 +1548,45 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>&
     }
 
     // call shape inference API
-    std::vector<StaticShape> output_shapes = shapeInference->infer(input_shapes, input_values);
+    auto& output_shapes = shapeInferOutputShapes;
+    shapeInference->infer(input_shapes, output_shapes, input_values);
 
     std::vector<VectorDims> result(output_shapes.size());
-    std::transform(output_shapes.begin(), output_shapes.end(), result.begin(), [](const StaticShape& s) {
-        return s.to_shape();
-    });
+    for (size_t i = 0; i < output_shapes.size(); i++) {
+        result[i].resize(output_shapes[i].size());
+        std::transform(output_shapes[i].begin(), output_shapes[i].end(), result[i].begin(), [](const StaticDimension& d) {
+            return d.get_length();
+        });
+    }
 
     return result;
 }
 
 std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes,
                                                       uint32_t input_value_port_mask) const {
-    std::vector<StaticShape> input_shapes;
+    auto& input_shapes = shapeInferInputShapes;
 
-    input_shapes.reserve(shapes.size());
-    for (size_t i = 0; i < shapes.size(); i++)
-        input_shapes.emplace_back(shapes[i].getStaticDims());
+    input_shapes.resize(shapes.size());
+    for (size_t i = 0; i < shapes.size(); i++) {
+        const auto& dims = shapes[i].getStaticDims();
+        input_shapes[i].assign(dims.begin(), dims.end());
+    }
 
     return shapeInferGeneric(input_shapes, input_value_port_mask);
 }
 
 std::vector<VectorDims> Node::shapeInferGeneric(uint32_t input_value_port_mask) const {
-    std::vector<StaticShape> input_shapes;
+    auto& input_shapes = shapeInferInputShapes;
     const auto & iranks = shapeInference->get_input_ranks();
 
-    input_shapes.reserve(iranks.size());
+    input_shapes.resize(iranks.size());
 
     for (size_t port = 0; port < iranks.size(); port++) {
         if (iranks[port] == 0) {
-            input_shapes.emplace_back();
+            input_shapes[port].clear();
         } else {
-            input_shapes.emplace_back(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims());
+            const auto& dims = getParentEdgesAtPort(port)[0]->getMemory().getStaticDims();
+            input_shapes[port].assign(dims.begin(), dims.end());
         }
     }
 
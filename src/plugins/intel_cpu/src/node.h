@@ -331,8 +331,28 @@ public:
 
     void resolveInPlaceEdges();
 
+    /**
+     * @brief State prepared by prepareParams() for the current input shapes
+     */
+    struct PreparedState {
+        virtual ~PreparedState() = default;
+    };
+    using PreparedStatePtr = std::shared_ptr<const PreparedState>;
+
+    /**
+     * @brief Results of the dynamic shapes processing for particular input dims. The Graph keeps them per graph input
+     * shapes, so the shape inference and the parameters preparation are skipped when the shapes are repeated
+     */
+    struct ShapesRecord {
+        std::vector<VectorDims> inputDims;
+        // empty if the shape inference results can't be reused (see isShapeInferReusable)
+        std::vector<VectorDims> outputDims;
+        // nullptr if the node doesn't support the prepared state restoring (see getPreparedState)
+        PreparedStatePtr preparedState;
+    };
+
     virtual void execute(dnnl::stream strm);
-    void executeDynamic(dnnl::stream strm);
+    void executeDynamic(dnnl::stream strm, ShapesRecord* record = nullptr);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
 
     virtual void initSupportedPrimitiveDescriptors();
@@ -727,6 +747,20 @@ protected:
     std::vector<VectorDims> shapeInferGeneric(const std::vector<Shape>& inputDims, uint32_t value_port_mask = 0) const;
     std::vector<VectorDims> shapeInferGeneric(uint32_t value_port_mask = 0) const;
     virtual std::vector<VectorDims> shapeInfer() const;
+    /**
+     * @brief Whether the output shapes are defined by the input shapes only and the shape inference has no side
+     * effects, so its results may be reused for the same input dims. The shape inference reading the values of
+     * non-constant inputs via shapeInferGeneric() is detected automatically, other cases have to be overridden
+     */
+    virtual bool isShapeInferReusable() const {
+        return !shapeInferDataDependent;
+    }
+    bool hasNonConstInputs(uint32_t portMask) const;
+    // The nodes which are able to snapshot and restore the state prepared by prepareParams() override both
+    virtual PreparedStatePtr getPreparedState() const {
+        return nullptr;
+    }
+    virtual void restorePreparedState(const PreparedStatePtr& state) {}
     // TODO [DS] : make pure after all nodes will be support dynamic shapes
     virtual void executeDynamicImpl(dnnl::stream strm) {
         IE_THROW(NotImplemented) << "[DS] executeDynamicImpl not implemented for node with type: " << getTypeStr();
@@ -770,6 +804,14 @@ private:
 
     MultiCachePtr rtParamsCache;
 
+    // set once the shape inference has read the values of non-constant inputs
+    mutable bool shapeInferDataDependent = false;
+    // shape inference buffers reused between the calls, the dims are stored inline so no allocations happen
+    mutable std::vector<StaticShape> shapeInferInputShapes;
+    mutable std::vector<StaticShape> shapeInferOutputShapes;
+
+    bool inputDimsEqual(const std::vector<VectorDims>& dims) const;
+
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
     template <class PD, class D, typename FPD>
@@ -4,6 +4,8 @@
 
 #include "cpu_convert.h"
 #include "cpu_memcpy.h"
+#include "cache/cache_entry.h"
+#include "emitters/jit_load_store_emitters.hpp"
 #include <utils/bfloat16.hpp>
 #include <utils/general_utils.h>
 #include <utils/jit_kernel.hpp>
@@ -15,6 +17,8 @@
 #include <type_traits>
 #include <tuple>
 #include <cmath>
+#include <limits>
+#include <unordered_map>
 #include <onednn/dnnl.h>
 
 using namespace InferenceEngine;
@@ -462,6 +466,44 @@ struct ConvertPrecision<std::tuple<ov::float16, ov::float16>> {
     }
 };
 
+struct ConvertScaleShiftContext {
+    const void *srcPtr;
+    void *dstPtr;
+    size_t size;
+    float scale;
+    float shift;
+    Precision dstPrc;
+    bool converted;
+};
+
+template<typename T>
+struct ConvertScaleShift;
+
+// The fallback of the JIT kernel: the value is scaled and shifted in fp32, then clamped to the destination range,
+// so the conversion is done in a single pass without the intermediate fp32 buffer.
+template<typename src_t, typename dst_t>
+struct ConvertScaleShift<std::tuple<src_t, dst_t>> {
+    void operator()(ConvertScaleShiftContext & ctx) {
+        auto src = static_cast<const src_t *>(ctx.srcPtr);
+        auto dst = static_cast<dst_t *>(ctx.dstPtr);
+        const auto scale = ctx.scale;
+        const auto shift = ctx.shift;
+
+        constexpr double fp32Lowest = static_cast<double>(std::numeric_limits<float>::lowest());
+        constexpr double fp32Max = static_cast<double>(std::numeric_limits<float>::max());
+        Range<float> r;
+        float lbound, ubound;
+        std::tie(lbound, ubound) = r.fit(ctx.dstPrc);
+
+        parallel_for(ctx.size, [&](size_t i) {
+            const auto value = static_cast<float>(std::max(std::min(static_cast<double>(src[i]), fp32Max), fp32Lowest));
+            dst[i] = static_cast<dst_t>(std::max(std::min(value * scale + shift, ubound), lbound));
+        });
+
+        ctx.converted = true;
+    }
+};
+
 bool isConversionTruncatesRange(const Precision & from, const Precision & to) {
     return to.bitsSize() < from.bitsSize()
             || (from.is_float() && !to.is_float())      // float -> integral
@@ -469,6 +511,327 @@ bool isConversionTruncatesRange(const Precision & from, const Precision & to) {
             || (to == Precision::BOOL && from != to);   // T -> bool
 }
 
+struct jit_convert_compile_params {
+    Precision src_prc;
+    Precision dst_prc;
+    bool with_scale_shift;  // src * scale + shift is converted
+    bool with_clamp;        // the values are clamped to [lbound, ubound]
+    bool with_trunc;        // the values are rounded toward zero
+
+    size_t hash() const {
+        size_t seed = 0;
+        seed = hash_combine(seed, src_prc.getPrecVal());
+        seed = hash_combine(seed, dst_prc.getPrecVal());
+        seed = hash_combine(seed, with_scale_shift);
+        seed = hash_combine(seed, with_clamp);
+        seed = hash_combine(seed, with_trunc);
+        return seed;
+    }
+
+    bool operator==(const jit_convert_compile_params& rhs) const {
+        return src_prc == rhs.src_prc && dst_prc == rhs.dst_prc && with_scale_shift == rhs.with_scale_shift &&
+               with_clamp == rhs.with_clamp && with_trunc == rhs.with_trunc;
+    }
+};
+
+struct jit_convert_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+    float lbound;
+    float ubound;
+    float scale;
+    float shift;
+};
+
+struct jit_uni_convert_kernel {
+    void (*ker_)(const jit_convert_call_args*);
+
+    void operator()(const jit_convert_call_args* call_args) {
+        assert(ker_);
+        ker_(call_args);
+    }
+
+    explicit jit_uni_convert_kernel(const jit_convert_compile_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_convert_compile_params jcp_;
+};
+
+/**
+ * The source values are loaded as fp32 (fp16 by vcvtph2ps), optionally scaled and shifted, clamped to the range
+ * of the interim and destination precisions and truncated exactly as the scalar ConvertPrecision does.
+ * The result is stored by the store emitter, integers are produced by vcvttps2dq.
+ */
+template <cpu_isa_t isa>
+struct jit_convert_kernel : public jit_uni_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_convert_kernel)
+
+    explicit jit_convert_kernel(const jit_convert_compile_params& jcp) : jit_uni_convert_kernel(jcp), jit_generator() {
+        vec_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+    }
+    virtual ~jit_convert_kernel() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu_isa_t::sse41, Xmm, isa == cpu_isa_t::avx2, Ymm, Zmm>::type;
+    // holds the fp16 values of one Vmm of fp32 values
+    using VmmHalf = typename std::conditional<isa == cpu_isa_t::avx512_core, Ymm, Xmm>::type;
+
+    void generate() override {
+        this->preamble();
+
+#define GET_OFF(field) offsetof(jit_convert_call_args, field)
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        if (jcp_.with_clamp) {
+            uni_vbroadcastss(vmm_lbound, ptr[reg_params + GET_OFF(lbound)]);
+            uni_vbroadcastss(vmm_ubound, ptr[reg_params + GET_OFF(ubound)]);
+        }
+        if (jcp_.with_scale_shift) {
+            uni_vbroadcastss(vmm_scale, ptr[reg_params + GET_OFF(scale)]);
+            uni_vbroadcastss(vmm_shift, ptr[reg_params + GET_OFF(shift)]);
+        }
+#undef GET_OFF
+
+        Xbyak::Label vector_loop_label;
+        Xbyak::Label vector_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_end_label;
+
+        L(vector_loop_label);
+        {
+            cmp(reg_work_amount, vec_size);
+            jl(vector_end_label, T_NEAR);
+
+            convert(vec_size);
+            add(reg_src, jcp_.src_prc.size() * vec_size);
+            add(reg_dst, jcp_.dst_prc.size() * vec_size);
+
+            sub(reg_work_amount, vec_size);
+            jmp(vector_loop_label, T_NEAR);
+        }
+        L(vector_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_end_label, T_NEAR);
+
+            convert(1);
+            add(reg_src, jcp_.src_prc.size());
+            add(reg_dst, jcp_.dst_prc.size());
+
+            dec(reg_work_amount);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_end_label);
+
+        this->postamble();
+
+        for (const auto& emitter : emitters) {
+            if (emitter.second)
+                emitter.second->emit_data();
+        }
+    }
+
+    void convert(size_t elt_num) {
+        if (jcp_.src_prc == Precision::FP16) {
+            load(vmm_half, reg_src, Precision::I16, Precision::I16, elt_num);
+            vcvtph2ps(vmm_val, VmmHalf(vmm_half.getIdx()));
+        } else {
+            load(vmm_val, reg_src, jcp_.src_prc, Precision::FP32, elt_num);
+        }
+
+        if (jcp_.with_scale_shift)
+            uni_vfmadd213ps(vmm_val, vmm_scale, vmm_shift);
+        // the data is the second operand to propagate NaN as std::min/std::max do
+        if (jcp_.with_clamp) {
+            uni_vminps(vmm_val, vmm_ubound, vmm_val);
+            uni_vmaxps(vmm_val, vmm_lbound, vmm_val);
+        }
+        if (jcp_.with_trunc)
+            uni_vroundps(vmm_val, vmm_val, 3);
+
+        switch (jcp_.dst_prc) {
+            case Precision::FP16:
+                vcvtps2ph(VmmHalf(vmm_half.getIdx()), vmm_val, 0);
+                store(reg_dst, vmm_half, Precision::I16, Precision::I16, elt_num);
+                break;
+            case Precision::FP32:
+            case Precision::BF16:
+                store(reg_dst, vmm_val, Precision::FP32, jcp_.dst_prc, elt_num);
+                break;
+            default:
+                // the values are already in the destination range, the conversion is a truncation like static_cast
+                uni_vcvttps2dq(vmm_val, vmm_val);
+                store(reg_dst, vmm_val, Precision::I32, jcp_.dst_prc, elt_num);
+                break;
+        }
+    }
+
+    inline void load(const Vmm& vmm_dst, const Xbyak::Reg64& reg_src, Precision src_prc, Precision dst_prc, const int& elt_num) {
+        const auto seed = load_emitter_params(src_prc, dst_prc, elt_num).hash();
+        if (!emitters[seed]) {
+            emitters[seed].reset(new jit_load_emitter(this, isa, src_prc, dst_prc, elt_num));
+        }
+
+        emitters[seed]->emit_code({static_cast<size_t>(reg_src.getIdx()), 0}, {static_cast<size_t>(vmm_dst.getIdx())},
+                                  pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+    }
+    inline void store(const Xbyak::Reg64& reg_dst, const Vmm& vmm_src, Precision src_prc, Precision dst_prc, const int& elt_num) {
+        const auto seed = store_emitter_params(src_prc, dst_prc, elt_num).hash();
+        if (!emitters[seed]) {
+            emitters[seed].reset(new jit_store_emitter(this, isa, src_prc, dst_prc, elt_num));
+        }
+
+        emitters[seed]->emit_code({static_cast<size_t>(vmm_src.getIdx()), 0}, {static_cast<size_t>(reg_dst.getIdx())},
+                                  pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+    }
+
+    size_t vec_size;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_half = Vmm(1);
+    Vmm vmm_lbound = Vmm(2);
+    Vmm vmm_ubound = Vmm(3);
+    Vmm vmm_scale = Vmm(4);
+    Vmm vmm_shift = Vmm(5);
+    Vmm vmm_aux0 = Vmm(6);
+    Vmm vmm_aux1 = Vmm(7);
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_work_amount = r10;
+    Reg64 reg_params = abi_param1;
+
+    const std::vector<size_t> pool_aux_gpr_idxs = { static_cast<size_t>(rsi.getIdx()), static_cast<size_t>(rbp.getIdx()) };
+    const std::vector<size_t> pool_aux_vmm_idxs = { static_cast<size_t>(vmm_aux0.getIdx()), static_cast<size_t>(vmm_aux1.getIdx()) };
+
+    std::unordered_map<size_t, std::unique_ptr<jit_emitter>> emitters;
+};
+
+bool isJitConvertSupported(const Precision& srcPrc, const Precision& dstPrc, bool withScaleShift) {
+    if (!mayiuse(cpu_isa_t::avx2))
+        return false;
+    if (!one_of(srcPrc, Precision::U8, Precision::I8, Precision::U16, Precision::I16, Precision::I32,
+                        Precision::FP32, Precision::FP16, Precision::BF16) ||
+        !one_of(dstPrc, Precision::U8, Precision::I8, Precision::U16, Precision::I16, Precision::I32,
+                        Precision::FP32, Precision::FP16, Precision::BF16))
+        return false;
+    if (one_of(Precision::FP16, srcPrc, dstPrc) && !dnnl::impl::cpu::x64::cpu().has(Xbyak::util::Cpu::tF16C))
+        return false;
+    // the integers above 2^24 aren't exact in fp32
+    if (srcPrc == Precision::I32 && dstPrc == Precision::I32)
+        return false;
+    // the store emitter rounds fp32 -> bf16 differently from bfloat16_t, so only the exact conversions are used
+    if (dstPrc == Precision::BF16 &&
+        (!mayiuse(cpu_isa_t::avx512_core) || !one_of(srcPrc, Precision::U8, Precision::I8) || withScaleShift))
+        return false;
+    return true;
+}
+
+std::shared_ptr<jit_uni_convert_kernel> getJitConvertKernel(const jit_convert_compile_params& jcp) {
+    // the key space is bounded by the supported precisions, so the kernels are never evicted in practice
+    constexpr size_t kernelCacheCapacity = 1024;
+    static CacheEntry<jit_convert_compile_params, std::shared_ptr<jit_uni_convert_kernel>> kernels(kernelCacheCapacity);
+
+    auto builder = [](const jit_convert_compile_params& key) -> std::shared_ptr<jit_uni_convert_kernel> {
+        std::shared_ptr<jit_uni_convert_kernel> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.reset(new jit_convert_kernel<cpu_isa_t::avx512_core>(key));
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.reset(new jit_convert_kernel<cpu_isa_t::avx2>(key));
+        } else {
+            return nullptr;
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+    return kernels.getOrCreate(jcp, builder).first;
+}
+
+// Returns the fp32 bounds of the values of src_t which fit both the interim and the destination precisions
+// and whether they are narrower than the range of src_t
+template <typename src_t>
+bool fitRange(const Precision& interimPrc, const Precision& dstPrc, float& lbound, float& ubound) {
+    Range<src_t> r;
+    r.fit(interimPrc);
+    const auto& range = r.fit(dstPrc);
+    lbound = static_cast<float>(std::get<0>(range));
+    ubound = static_cast<float>(std::get<1>(range));
+    return static_cast<double>(std::get<0>(range)) > static_cast<double>(std::numeric_limits<src_t>::lowest()) ||
+           static_cast<double>(std::get<1>(range)) < static_cast<double>(std::numeric_limits<src_t>::max());
+}
+
+bool fitRange(const Precision& srcPrc, const Precision& interimPrc, const Precision& dstPrc, float& lbound, float& ubound) {
+    switch (srcPrc) {
+        case Precision::U8: return fitRange<uint8_t>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::I8: return fitRange<int8_t>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::U16: return fitRange<uint16_t>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::I16: return fitRange<int16_t>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::I32: return fitRange<int32_t>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::FP32: return fitRange<float>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::FP16: return fitRange<ov::float16>(interimPrc, dstPrc, lbound, ubound);
+        case Precision::BF16: return fitRange<ov::intel_cpu::bfloat16_t>(interimPrc, dstPrc, lbound, ubound);
+        default: IE_THROW() << "Unsupported precision";
+    }
+}
+
+/**
+ * Converts the buffer by the JIT kernel if the precisions are supported, the conversion is split between the threads
+ * by the blocks of jitConvertBlock elements. Returns false if the conversion isn't supported.
+ */
+bool jitConvert(const void *srcPtr, void *dstPtr, const Precision& srcPrc, const Precision& interimPrc, const Precision& dstPrc,
+                const size_t size, const float* scale, const float* shift) {
+    constexpr size_t jitConvertBlock = 16384;
+
+    const bool withScaleShift = scale && shift;
+    if (!isJitConvertSupported(srcPrc, dstPrc, withScaleShift))
+        return false;
+
+    jit_convert_compile_params jcp;
+    jcp.src_prc = srcPrc;
+    jcp.dst_prc = dstPrc;
+    jcp.with_scale_shift = withScaleShift;
+    float lbound, ubound;
+    if (withScaleShift) {
+        // the scaled values are fp32, the interim precision is the destination one
+        jcp.with_clamp = fitRange(Precision::FP32, dstPrc, dstPrc, lbound, ubound);
+        jcp.with_trunc = false;
+    } else {
+        jcp.with_clamp = fitRange(srcPrc, interimPrc, dstPrc, lbound, ubound);
+        jcp.with_trunc = srcPrc.is_float() && !interimPrc.is_float() && dstPrc.is_float();
+    }
+
+    const auto kernel = getJitConvertKernel(jcp);
+    if (!kernel)
+        return false;
+
+    auto src = static_cast<const uint8_t *>(srcPtr);
+    auto dst = static_cast<uint8_t *>(dstPtr);
+    parallel_for(div_up(size, jitConvertBlock), [&](size_t i) {
+        const size_t offset = i * jitConvertBlock;
+        jit_convert_call_args args;
+        args.src = src + offset * srcPrc.size();
+        args.dst = dst + offset * dstPrc.size();
+        args.work_amount = std::min(jitConvertBlock, size - offset);
+        args.lbound = lbound;
+        args.ubound = ubound;
+        args.scale = withScaleShift ? *scale : 1.f;
+        args.shift = withScaleShift ? *shift : 0.f;
+        (*kernel)(&args);
+    });
+    return true;
+}
+
 }   // namespace
 
 #define INTEL_CPU_CVT(ST, DT) OV_CASE2(Precision::ST, Precision::DT, PrecisionInfo<Precision::ST>::value_type, PrecisionInfo<Precision::DT>::value_type)
@@ -593,7 +956,7 @@ void cpu_convert(const void *srcPtr,
         if (!ctx.converted)
             IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " <bitsSize == " << srcPrc.bitsSize()
                                                              << "> precision to: " << dstPrc;
-    } else {
+    } else if (!jitConvert(srcPtr, dstPtr, srcPrc, interimPrc, dstPrc, size, nullptr, nullptr)) {
         ConvertContext ctx {
             srcPtr,
             dstPtr,
@@ -608,6 +971,33 @@ void cpu_convert(const void *srcPtr,
     }
 }
 
+void cpu_convert(const void *srcPtr,
+                 void *dstPtr,
+                 InferenceEngine::Precision srcPrc,
+                 InferenceEngine::Precision dstPrc,
+                 const size_t size,
+                 float scale,
+                 float shift) {
+    if (srcPtr == nullptr || dstPtr == nullptr)
+        IE_THROW() << "cpu_convert has null data pointer";
+
+    if (jitConvert(srcPtr, dstPtr, srcPrc, dstPrc, dstPrc, size, &scale, &shift))
+        return;
+
+    ConvertScaleShiftContext ctx {
+        srcPtr,
+        dstPtr,
+        size,
+        scale,
+        shift,
+        dstPrc,
+        false
+    };
+    OV_SWITCH(intel_cpu, ConvertScaleShift, ctx, std::tie(srcPrc, dstPrc), INTEL_CPU_CVT_LIST);
+    if (!ctx.converted)
+        IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
+}
+
 #undef INTEL_CPU_CVT
 #undef INTEL_CPU_CVT_LIST
 
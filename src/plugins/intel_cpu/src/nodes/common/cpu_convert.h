@@ -52,5 +52,32 @@ void cpu_convert(const void *srcPtr,
                  InferenceEngine::Precision dstPrc,
                  const size_t size);
 
+/**
+ * @brief Copy size elements from buffer specified srcPtr pointer to buffer specified dstPtr
+ * applying the scale and the shift in fp32: dst = convert(src * scale + shift).
+ * @param srcPtr
+ * pointer to the buffer to convert from
+ * @param dstPtr
+ * pointer to the buffer to convert to
+ * @param srcPrc
+ * precision the buffer from which convert
+ * @param dstPrc
+ * precision the buffer to which convert
+ * @param size
+ * number of elements in buffers to be converted
+ * @param scale
+ * multiplier of the source values
+ * @param shift
+ * value added to the scaled source values
+ * @return none.
+ */
+void cpu_convert(const void *srcPtr,
+                 void *dstPtr,
+                 InferenceEngine::Precision srcPrc,
+                 InferenceEngine::Precision dstPrc,
+                 const size_t size,
+                 float scale,
+                 float shift);
+
 }   // namespace intel_cpu
 }   // namespace ov
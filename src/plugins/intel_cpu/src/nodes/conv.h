@@ -65,6 +65,9 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    // the paddings are taken from the shape inference
+    bool isShapeInferReusable() const override { return !autoPadding && Node::isShapeInferReusable(); }
+
 protected:
     InferenceEngine::Precision fusedEltwisePrecision(const NodePtr& fusingNode) const;
     void redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes) override;
@@ -50,6 +50,8 @@ public:
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    // the paddings are taken from the shape inference
+    bool isShapeInferReusable() const override { return !autoPad && !externOutShape && Node::isShapeInferReusable(); }
 
     void setDynamicBatchLim(int lim) override;
 
@@ -1991,6 +1991,23 @@ void Eltwise::prepareParams() {
     execPtr = result.first;
 }
 
+Node::PreparedStatePtr Eltwise::getPreparedState() const {
+    auto state = std::make_shared<EltwisePreparedState>();
+    state->execPtr = execPtr;
+    state->currentInBlkDims = currentInBlkDims;
+    state->start_offset_in = start_offset_in;
+    state->start_offset_out = start_offset_out;
+    return state;
+}
+
+void Eltwise::restorePreparedState(const PreparedStatePtr& state) {
+    const auto& eltwiseState = static_cast<const EltwisePreparedState&>(*state);
+    execPtr = eltwiseState.execPtr;
+    currentInBlkDims = eltwiseState.currentInBlkDims;
+    start_offset_in = eltwiseState.start_offset_in;
+    start_offset_out = eltwiseState.start_offset_out;
+}
+
 bool Eltwise::needPrepareParams() const {
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         if (getParentEdgesAtPort(i)[0]->getMemory().GetDescWithType<BlockedMemoryDesc>()->getBlockDims() != currentInBlkDims[i])
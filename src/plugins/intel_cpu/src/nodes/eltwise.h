@@ -117,6 +117,8 @@ public:
     std::vector<VectorDims> shapeInfer() const override;
     bool needPrepareParams() const override;
     void prepareParams() override;
+    PreparedStatePtr getPreparedState() const override;
+    void restorePreparedState(const PreparedStatePtr& state) override;
 
     void executeDynamicImpl(dnnl::stream strm) override;
 
@@ -148,6 +150,13 @@ private:
     // blocked dims for which kernel compiled and params prepared
     std::vector<VectorDims> currentInBlkDims = {};
 
+    struct EltwisePreparedState : public PreparedState {
+        executorPtr execPtr;
+        std::vector<VectorDims> currentInBlkDims;
+        std::vector<ptrdiff_t> start_offset_in;
+        ptrdiff_t start_offset_out;
+    };
+
     float alpha = 0;
     float beta = 0;
     float gamma = 0;
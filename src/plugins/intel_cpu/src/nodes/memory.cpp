@@ -79,11 +79,21 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+bool MemoryOutput::isExecutable() const {
+    auto inputMemoryNode = dynamic_cast<const MemoryInput*>(inputNode);
+    if (inputMemoryNode && inputMemoryNode->isStateInPlace())
+        return false;
+    return Node::isExecutable();
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
+    // the producer has already written the new state into the bound buffer
+    if (inputMemoryNode->isStateInPlace())
+        return;
     inputMemoryNode->storeState(srcMemory);
 }
 
@@ -125,6 +135,10 @@ void MemoryInput::createPrimitive() {
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
         dataStore->FillZero();
+
+    // the edges are allocated at this point, so the binding is decided once and both memory nodes
+    // leave the list of the executable nodes when the state is bound in place
+    stateInPlace = canBindStateInPlace();
 }
 
 /**
@@ -165,7 +179,56 @@ void MemoryInput::storeState(const Memory &new_state) {
     simple_copy(*dataStore, new_state);
 }
 
+bool MemoryInput::canBindStateInPlace() {
+    if (outputNode == nullptr)
+        return false;
+
+    const auto& childEdges = getChildEdgesAtPort(0);
+    if (childEdges.empty())
+        return false;
+    auto writeEdge = outputNode->getParentEdgeAt(0);
+    const auto& readMem = childEdges[0]->getMemory();
+    const auto& writeMem = writeEdge->getMemory();
+    if (!readMem.getDesc().isCompatible(writeMem.getDesc()) ||
+        readMem.getDnnlMemoryMngr() == writeMem.getDnnlMemoryMngr())
+        return false;
+
+    // The same restrictions as for external input pointers: every consumer must read the edge memory as is
+    for (const auto& edge : childEdges) {
+        auto child = edge->getChild();
+        if (child->isConstant() || child->isInPlace() || child->getType() == Type::Split)
+            return false;
+        for (const auto& childEdge : child->getChildEdges()) {
+            auto e = childEdge.lock();
+            if (!e || e->getMemory().GetData() == edge->getMemory().GetData())
+                return false;
+        }
+    }
+
+    // ...and for external output pointers: the producer of Assign must write into this very edge
+    auto parent = writeEdge->getParent();
+    if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+        return false;
+
+    return true;
+}
+
+bool MemoryInput::bindState(const MemoryPtr& current, const MemoryPtr& next) {
+    if (!stateInPlace) {
+        dataStore->setDataHandle(current->GetData());
+        return false;
+    }
+
+    for (const auto& edge : getChildEdgesAtPort(0))
+        edge->getMemoryPtr()->setDataHandle(current->GetData());
+    outputNode->getParentEdgeAt(0)->getMemoryPtr()->setDataHandle(next->GetData());
+    return true;
+}
+
 void MemoryInput::execute(dnnl::stream strm) {
+    // consumers read the bound state buffer directly
+    if (stateInPlace)
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
@@ -181,6 +244,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput
         auto outputNode = dynamic_cast<MemoryOutput*>(sibling);
         IE_ASSERT(outputNode != nullptr);
         outputNode->setInputNode(node);
+        node->setOutputNode(outputNode);
     } else {
         holder[node->getId()] = node;
     }
@@ -196,6 +260,7 @@ MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerOutput(MemoryOutpu
         auto inputNode = dynamic_cast<MemoryInput*>(sibling);
         IE_ASSERT(inputNode != nullptr);
         node->setInputNode(inputNode);
+        inputNode->setOutputNode(node);
     } else {
         holder[node->getId()] = node;
     }
@@ -71,6 +71,7 @@ public:
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
+    bool isExecutable() const override;
 
     void setInputNode(Node* node) override {
         inputNode = node;
@@ -94,17 +95,40 @@ public:
         return getType() == Type::MemoryInput;
     }
     bool isExecutable() const override {
-        return true;
+        // the state bound in place needs no copy
+        return !stateInPlace;
     }
     void execute(dnnl::stream strm) override;
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
+    void setOutputNode(MemoryOutput* node) {
+        outputNode = node;
+    }
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief Points the node to the variable state buffers of the infer request being executed.
+     * When the graph allows it, consumers of ReadValue read straight from @p current and the producer
+     * of the paired Assign writes into @p next, so no data is copied during the inference.
+     * Otherwise the state is copied from and back to @p current by the memory nodes.
+     * @param current buffer holding the current value of the variable
+     * @param next buffer of the same layout receiving the new value
+     * @return true if the new value ends up in @p next and the caller has to swap the buffers
+     */
+    bool bindState(const MemoryPtr& current, const MemoryPtr& next);
+    bool isStateInPlace() const {
+        return stateInPlace;
+    }
+
  private:
+    bool canBindStateInPlace();
+
     MemoryPtr dataStore;
+    MemoryOutput* outputNode = nullptr;
+    bool stateInPlace = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
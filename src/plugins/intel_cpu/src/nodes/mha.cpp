@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -17,6 +19,7 @@
 #include "ngraph_transformations/op/mha.hpp"
 #include "dnnl_extension_utils.h"
 #include <ie_ngraph_utils.hpp>
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -70,7 +73,12 @@ private:
         mov(reg_buffer_aux, reg_buffer);
         mov(reg_work_amount, jcp_.work_amount);
         mov(reg_work_amount_aux, reg_work_amount);
-        uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
+        if (jcp_.is_online) {
+            mov(reg_max, ptr[reg_params + GET_OFF(p_max)]);
+            uni_vbroadcastss(get_vmm_max(0), ptr[reg_max]);
+        } else {
+            uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
+        }
 
         // mul1 input is const and always float
         if (jcp_.with_mul_scales) {
@@ -114,12 +122,20 @@ private:
 
         sub(rsp, sizeof(float) * vec_size);
         uni_vmovups(ptr[rsp], get_vmm_max(0));
-        uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
+        if (jcp_.is_online) {
+            mov(reg_max, ptr[reg_params + GET_OFF(p_max)]);
+            uni_vmovss(get_xmm_max(0), ptr[reg_max]);
+        } else {
+            uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
+        }
         for (size_t i = 0; i < vec_size; i++) {
             mov(reg_tmp_32, ptr[rsp + i * sizeof(float)]);
             vmovq(xmm_tmp, reg_tmp);
             uni_vmaxps(get_xmm_max(0), get_xmm_max(0), xmm_tmp);
         }
+        if (jcp_.is_online) {
+            uni_vmovss(ptr[reg_max], get_xmm_max(0));
+        }
         uni_vbroadcastss(get_vmm_max(0), get_xmm_max(0));
         add(rsp, sizeof(float) * vec_size);
 
@@ -153,10 +169,23 @@ private:
         vbroadcastss(get_vmm_aux(0), get_xmm_aux(0));
         add(rsp, sizeof(float) * vec_size);
 
-        mov(reg_tmp, dnnl::impl::float2int(1.0f));
-        vmovq(xmm_tmp, reg_tmp);
-        vbroadcastss(get_vmm_denom(0), xmm_tmp);
-        uni_vdivps(get_vmm_denom(0), get_vmm_denom(0), get_vmm_aux(0));
+        if (jcp_.is_online) {
+            // normalization is postponed until all the blocks of the row are processed
+            mov(reg_tmp, ptr[reg_params + GET_OFF(p_sum)]);
+            uni_vmovss(ptr[reg_tmp], get_xmm_aux(0));
+
+            // f32 exponents are already stored in place
+            if (jcp_.dst_prc == Precision::FP32) {
+                this->postamble();
+                emit_emitters_data();
+                return;
+            }
+        } else {
+            mov(reg_tmp, dnnl::impl::float2int(1.0f));
+            vmovq(xmm_tmp, reg_tmp);
+            vbroadcastss(get_vmm_denom(0), xmm_tmp);
+            uni_vdivps(get_vmm_denom(0), get_vmm_denom(0), get_vmm_aux(0));
+        }
 
         if (jcp_.with_scales1)
             mov(reg_scales, ptr[reg_params + GET_OFF(p_scales1)]);
@@ -185,6 +214,10 @@ private:
 
         this->postamble();
 
+        emit_emitters_data();
+    }
+
+    void emit_emitters_data() {
         for (const auto& emitter : emitters) {
             if (emitter.second)
                 emitter.second->emit_data();
@@ -256,7 +289,8 @@ private:
 
         load(get_vmm_in(0), reg_buffer, Precision::FP32, step, is_tail);
 
-        uni_vmulps(get_vmm_in(0), get_vmm_in(0), get_vmm_denom(0));
+        if (!jcp_.is_online)
+            uni_vmulps(get_vmm_in(0), get_vmm_in(0), get_vmm_denom(0));
 
         if (jcp_.src_prc == Precision::I32) {
             if (jcp_.with_scales1) {
@@ -670,9 +704,17 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
             return false;
         }
 
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
+        for (auto idx : {0, 1, 3}) {
+            const auto& inputShape = mha->get_input_partial_shape(idx);
+            if (inputShape.rank() != 4) {
+                errorMessage = "Doesn't support inputs with rank != 4";
+                return false;
+            }
+            // only batch and sequence dimensions may be dynamic
+            if (inputShape[2].is_dynamic() || inputShape[3].is_dynamic()) {
+                errorMessage = "Doesn't support dynamic number of heads or head size";
+                return false;
+            }
         }
 
         bool supportedPrecisions = true;
@@ -726,11 +768,6 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
             errorMessage = "Doesn't support i8 execution precision on targets w/o avx512_core_vnni support";
             return false;
         }
-
-        if (mha->get_input_shape(0).size() != 4) {
-            errorMessage = "Doesn't support inputs with rank != 4";
-            return false;
-        }
     } catch (...) {
         return false;
     }
@@ -738,6 +775,85 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
     return true;
 }
 
+namespace {
+struct BrgemmKey {
+    size_t M, N, K, LDA, LDB, LDC;
+    dnnl_data_type_t dt_in0, dt_in1;
+    float beta;
+    bool use_amx;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+
+        size_t seed = 0;
+        for (const auto dim : {M, N, K, LDA, LDB, LDC})
+            seed = hash_combine(seed, dim);
+        seed = hash_combine(seed, dt_in0);
+        seed = hash_combine(seed, dt_in1);
+        seed = hash_combine(seed, beta);
+        seed = hash_combine(seed, use_amx);
+        return seed;
+    }
+
+    bool operator==(const BrgemmKey& rhs) const {
+        return M == rhs.M && N == rhs.N && K == rhs.K && LDA == rhs.LDA && LDB == rhs.LDB && LDC == rhs.LDC &&
+               dt_in0 == rhs.dt_in0 && dt_in1 == rhs.dt_in1 && beta == rhs.beta && use_amx == rhs.use_amx;
+    }
+};
+
+struct MulAddSoftmaxKey {
+    jit_mul_add_softmax_compile_params jcp;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+
+        size_t seed = 0;
+        seed = hash_combine(seed, jcp.src_prc.getPrecVal());
+        seed = hash_combine(seed, jcp.dst_prc.getPrecVal());
+        seed = hash_combine(seed, jcp.work_amount);
+        for (const auto flag : {jcp.with_mul_scales, jcp.is_mul_first, jcp.with_scales0, jcp.broadcast_scales0,
+                                jcp.with_scales1, jcp.broadcast_scales1, jcp.is_online})
+            seed = hash_combine(seed, flag);
+        return seed;
+    }
+
+    bool operator==(const MulAddSoftmaxKey& rhs) const {
+        return jcp.src_prc == rhs.jcp.src_prc && jcp.dst_prc == rhs.jcp.dst_prc && jcp.work_amount == rhs.jcp.work_amount &&
+               jcp.with_mul_scales == rhs.jcp.with_mul_scales && jcp.is_mul_first == rhs.jcp.is_mul_first &&
+               jcp.with_scales0 == rhs.jcp.with_scales0 && jcp.broadcast_scales0 == rhs.jcp.broadcast_scales0 &&
+               jcp.with_scales1 == rhs.jcp.with_scales1 && jcp.broadcast_scales1 == rhs.jcp.broadcast_scales1 &&
+               jcp.is_online == rhs.jcp.is_online;
+    }
+};
+
+struct ConvertReorderKey {
+    jit_convert_reorder_compile_params jcp;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+
+        size_t seed = 0;
+        seed = hash_combine(seed, jcp.src_prc.getPrecVal());
+        seed = hash_combine(seed, jcp.dst_prc.getPrecVal());
+        seed = hash_combine(seed, jcp.inner_work_amount);
+        seed = hash_combine(seed, jcp.with_scales);
+        seed = hash_combine(seed, jcp.broadcast_scales);
+        seed = hash_combine(seed, jcp.src_stride);
+        seed = hash_combine(seed, jcp.dst_stride);
+        return seed;
+    }
+
+    bool operator==(const ConvertReorderKey& rhs) const {
+        return jcp.src_prc == rhs.jcp.src_prc && jcp.dst_prc == rhs.jcp.dst_prc && jcp.inner_work_amount == rhs.jcp.inner_work_amount &&
+               jcp.with_scales == rhs.jcp.with_scales && jcp.broadcast_scales == rhs.jcp.broadcast_scales &&
+               jcp.src_stride == rhs.jcp.src_stride && jcp.dst_stride == rhs.jcp.dst_stride;
+    }
+};
+}  // namespace
+
 MHA::MHA(const std::shared_ptr<ov::Node>& op, const dnnl::engine& eng,
         WeightsSharing::Ptr &cache) : Node(op, eng, cache) {
     std::string errorMessage;
@@ -816,6 +932,63 @@ void MHA::init_brgemm(brgemmCtx& ctx, std::unique_ptr<brgemm_kernel_t>& brgKerne
     brgKernel.reset(brgKernel_);
 }
 
+std::shared_ptr<MHA::brgemmKernel> MHA::getBrgemmKernel(brgemmCtx& ctx, bool use_amx) {
+    BrgemmKey key = {ctx.M, ctx.N, ctx.K, ctx.LDA, ctx.LDB, ctx.LDC, ctx.dt_in0, ctx.dt_in1, ctx.beta, use_amx};
+
+    auto builder = [this, &ctx](const BrgemmKey& key) -> std::shared_ptr<brgemmKernel> {
+        auto kernel = std::make_shared<brgemmKernel>();
+        kernel->ctx = ctx;
+        init_brgemm(kernel->ctx, kernel->ker, key.use_amx);
+        return kernel;
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    // the tile palette and the execution flags are defined by the kernel
+    ctx = result.first->ctx;
+    return result.first;
+}
+
+std::shared_ptr<jit_uni_mul_add_softmax_kernel> MHA::getMulAddSoftmaxKernel(const jit_mul_add_softmax_compile_params& jcp) {
+    auto builder = [this](const MulAddSoftmaxKey& key) -> std::shared_ptr<jit_uni_mul_add_softmax_kernel> {
+        std::shared_ptr<jit_uni_mul_add_softmax_kernel> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx512_core>(key.jcp));
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx2>(key.jcp));
+        } else if (mayiuse(cpu_isa_t::sse41)) {
+            kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::sse41>(key.jcp));
+        } else {
+            THROW_ERROR << "cannot create jit eltwise kernel";
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    auto cache = getRuntimeCache();
+    return cache->getOrCreate(MulAddSoftmaxKey{jcp}, builder).first;
+}
+
+std::shared_ptr<jit_uni_convert_reorder_kernel> MHA::getConvertReorderKernel(const jit_convert_reorder_compile_params& jcp) {
+    auto builder = [this](const ConvertReorderKey& key) -> std::shared_ptr<jit_uni_convert_reorder_kernel> {
+        std::shared_ptr<jit_uni_convert_reorder_kernel> kernel;
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.reset(new jit_convert_reorder_kernel<cpu_isa_t::avx512_core>(key.jcp));
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.reset(new jit_convert_reorder_kernel<cpu_isa_t::avx2>(key.jcp));
+        } else if (mayiuse(cpu_isa_t::sse41)) {
+            kernel.reset(new jit_convert_reorder_kernel<cpu_isa_t::sse41>(key.jcp));
+        } else {
+            THROW_ERROR << "cannot create jit eltwise kernel";
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    auto cache = getRuntimeCache();
+    return cache->getOrCreate(ConvertReorderKey{jcp}, builder).first;
+}
+
 void MHA::init_brgemm_copy_a(std::unique_ptr<jit_brgemm_matmul_copy_a_t>& brgCopyKernel, size_t K, size_t K_blk, size_t K_tail,
         size_t LDA, dnnl_data_type_t dt_in0) {
     brgemm_matmul_conf_t brgCopyKernelConf;
@@ -910,6 +1083,7 @@ void MHA::prepareParams() {
     size_t numThreads = parallel_get_max_threads();
 
     size_t matmulOptimalM = 32;
+    size_t matmulOptimalS = 128;
 
     batch0 = dimsMatMul0Out[0];
     batch1 = dimsMatMul0Out[1];
@@ -921,46 +1095,58 @@ void MHA::prepareParams() {
     N0 = dimsMatMul0In1[3];
     K0 = dimsMatMul0In0[3];
 
+    if (dimsAddIn1[3] != N0 || !one_of(dimsAddIn1[0], 1u, batch0))
+        THROW_ERROR << "has unexpected shape of the Add input";
+
     auto brg0Prc = inputPrecisions[0];
     brg0VnniFactor = 4 / brg0Prc.size();
     bool brg0WithAMX = isAMXSupported && brg0Prc != Precision::FP32 && (K0 % brg0VnniFactor == 0) && (N0 % brg0VnniFactor == 0);
 
-    N0_blk = brg0Prc == Precision::FP32 ? N0 :
+    accPrecision0 = brg0Prc == Precision::I8 ? Precision::I32 : Precision::FP32;
+
+    // Quantized probabilities can't be rescaled, so the whole scores row is processed at once in this case
+    useOnlineSoftmax = accPrecision0 == Precision::FP32 && fqScales1.empty() && fqScales2.empty();
+    S_blk = useOnlineSoftmax ? std::min(N0, matmulOptimalS) : N0;
+    S_tail = N0 % S_blk;
+
+    N0_blk = brg0Prc == Precision::FP32 ? S_blk :
              brg0Prc == Precision::BF16 ? 32 : 64;
     N0_tail = N0 % N0_blk;
     K0_blk = brg0WithAMX ? brg0Prc == Precision::BF16 ? 32 : 64
                          : K0;
     K0_tail = K0 % K0_blk;
 
-    accPrecision0 = brg0Prc == Precision::I8 ? Precision::I32 : Precision::FP32;
-
     size_t brg0BaseIdx = -1;
-    for (size_t m = 0; m < 2; m++) {
-        for (size_t k = 0; k < 2; k++) {
-            for (size_t n = 0; n < 2; n++) {
-                auto& brgemmCtx = brgCtxs0[getBrgIdx(m, k, n)];
-
-                auto M_ = m ? M_tail
-                            : M < M_blk ? 0 : M_blk;
-                auto N_ = n ? N0_tail : N0 - N0_tail;
-                auto K_ = k ? K0_tail : K0 - K0_tail;
-                auto beta = k && brgCtxs0[getBrgIdx(m, 0, n)].K != 0 ? 1.0f : 0.0f;
-
-                brgemmCtx.M = M_;
-                brgemmCtx.N = N_;
-                brgemmCtx.K = K_;
-                brgemmCtx.LDA = batch1 * K0;
-                brgemmCtx.LDB = rnd_up(N0, N0_blk);
-                brgemmCtx.LDC = N0;
-                brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg0Prc));
-                brgemmCtx.dt_in1 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg0Prc));
-                brgemmCtx.beta = beta;
-
-                // don't create brgemm kernels for empty tiles
-                if (M_ != 0 && K_ != 0 && N_ != 0) {
-                    if (brg0BaseIdx == -1)
-                        brg0BaseIdx = getBrgIdx(m, k, n);
-                    init_brgemm(brgemmCtx, brgKernels0[getBrgIdx(m, k, n)], brg0WithAMX);
+    for (size_t s = 0; s < 2; s++) {
+        auto S_ = s ? S_tail : S_blk;
+        for (size_t m = 0; m < 2; m++) {
+            for (size_t k = 0; k < 2; k++) {
+                for (size_t n = 0; n < 2; n++) {
+                    auto& brgemmCtx = brgCtxs0[getBrgIdx(m, k, n, s)];
+
+                    auto M_ = m ? M_tail
+                                : M < M_blk ? 0 : M_blk;
+                    auto N_ = n ? S_ % N0_blk : S_ - S_ % N0_blk;
+                    auto K_ = k ? K0_tail : K0 - K0_tail;
+                    auto beta = k && brgCtxs0[getBrgIdx(m, 0, n, s)].K != 0 ? 1.0f : 0.0f;
+
+                    brgemmCtx.M = M_;
+                    brgemmCtx.N = N_;
+                    brgemmCtx.K = K_;
+                    brgemmCtx.LDA = batch1 * K0;
+                    brgemmCtx.LDB = brg0Prc == Precision::FP32 ? N0 : rnd_up(N0, N0_blk);
+                    brgemmCtx.LDC = S_blk;
+                    brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg0Prc));
+                    brgemmCtx.dt_in1 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg0Prc));
+                    brgemmCtx.beta = beta;
+
+                    // don't create brgemm kernels for empty tiles
+                    brgKernels0[getBrgIdx(m, k, n, s)].reset();
+                    if (M_ != 0 && K_ != 0 && N_ != 0) {
+                        if (brg0BaseIdx == -1)
+                            brg0BaseIdx = getBrgIdx(m, k, n, s);
+                        brgKernels0[getBrgIdx(m, k, n, s)] = getBrgemmKernel(brgemmCtx, brg0WithAMX);
+                    }
                 }
             }
         }
@@ -973,6 +1159,7 @@ void MHA::prepareParams() {
     //     init_brgemm_copy_a(brgCopyAKernel0, K0, K0_blk, K0_tail, brgemmCtx0.LDA, brgemmCtx0.dt_in0);
     // }
 
+    brgCopyBKernel0.reset();
     if (brgemmCtx0.is_with_amx || brg0Prc == Precision::I8 || brg0Prc == Precision::BF16) {
         init_brgemm_copy_b(brgCopyBKernel0, N0, N0_blk, N0_tail, brgemmCtx0.LDB, brgemmCtx0.K,
             brgemmCtx0.is_with_amx, brgemmCtx0.dt_in0, brgemmCtx0.dt_in1);
@@ -992,57 +1179,66 @@ void MHA::prepareParams() {
              brg1PrcIn1 == Precision::BF16 ? 32 : 64;
     N1_tail = N1 % N1_blk;
     K1_blk = brg1WithAMX ? brg1PrcIn0 == Precision::BF16 ? 32 : 64
-                         : K1;
+                         : S_blk;
     K1_tail = K1 % K1_blk;
 
     accPrecision1 = one_of(brg1PrcIn0, Precision::U8, Precision::I8) ? Precision::I32 : Precision::FP32;
 
     size_t brg1BaseIdx = -1;
-    for (size_t m = 0; m < 2; m++) {
-        for (size_t k = 0; k < 2; k++) {
-            for (size_t n = 0; n < 2; n++) {
-                auto& brgemmCtx = brgCtxs1[getBrgIdx(m, k, n)];
-
-                auto M_ = m ? M_tail
-                            : M < M_blk ? 0 : M_blk;
-                auto N_ = n ? N1_tail : N1 - N1_tail;
-                auto K_ = k ? K1_tail : K1 - K1_tail;
-
-                auto beta = k && brgCtxs1[getBrgIdx(m, 0, n)].K != 0 ? 1.0f : 0.0f;
-                brgemmCtx.M = M_;
-                brgemmCtx.N = N_;
-                brgemmCtx.K = K_;
-                brgemmCtx.LDA = K1;
-                brgemmCtx.LDB = brg1PrcIn1 == Precision::FP32 ? batch1 * N1 : rnd_up(N1, N1_blk);
-                brgemmCtx.LDC = accPrecision1 == getOriginalOutputPrecisionAtPort(0) ? batch1 * N1 : N1;
-                brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1PrcIn0));
-                brgemmCtx.dt_in1 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1PrcIn1));
-                brgemmCtx.beta = beta;
-
-                // don't create brgemm kernels for empty tiles
-                if (M_ != 0 && K_ != 0 && N_ != 0) {
-                    if (brg1BaseIdx == -1)
-                        brg1BaseIdx = getBrgIdx(m, k, n);
-
-                    init_brgemm(brgemmCtx, brgKernels1[getBrgIdx(m, k, n)], brg1WithAMX);
+    for (size_t s = 0; s < 2; s++) {
+        auto S_ = s ? S_tail : S_blk;
+        for (size_t m = 0; m < 2; m++) {
+            for (size_t k = 0; k < 2; k++) {
+                for (size_t n = 0; n < 2; n++) {
+                    auto& brgemmCtx = brgCtxs1[getBrgIdx(m, k, n, s)];
+
+                    auto M_ = m ? M_tail
+                                : M < M_blk ? 0 : M_blk;
+                    auto N_ = n ? N1_tail : N1 - N1_tail;
+                    auto K_ = k ? S_ % K1_blk : S_ - S_ % K1_blk;
+
+                    // the results of the key/value blocks are accumulated in the same output tile
+                    auto beta = useOnlineSoftmax || (k && brgCtxs1[getBrgIdx(m, 0, n, s)].K != 0) ? 1.0f : 0.0f;
+                    brgemmCtx.M = M_;
+                    brgemmCtx.N = N_;
+                    brgemmCtx.K = K_;
+                    brgemmCtx.LDA = S_blk;
+                    brgemmCtx.LDB = brg1PrcIn1 == Precision::FP32 ? batch1 * N1 : rnd_up(N1, N1_blk);
+                    brgemmCtx.LDC = !useOnlineSoftmax && accPrecision1 == getOriginalOutputPrecisionAtPort(0) ? batch1 * N1 : N1;
+                    brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1PrcIn0));
+                    brgemmCtx.dt_in1 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1PrcIn1));
+                    brgemmCtx.beta = beta;
+
+                    // don't create brgemm kernels for empty tiles
+                    brgKernels1[getBrgIdx(m, k, n, s)].reset();
+                    if (M_ != 0 && K_ != 0 && N_ != 0) {
+                        if (brg1BaseIdx == -1)
+                            brg1BaseIdx = getBrgIdx(m, k, n, s);
+
+                        brgKernels1[getBrgIdx(m, k, n, s)] = getBrgemmKernel(brgemmCtx, brg1WithAMX);
+                    }
                 }
             }
         }
     }
 
     auto& brgemmCtx1 = brgCtxs1[brg1BaseIdx];
+    brgCopyBKernel1.reset();
     if (brgemmCtx1.is_with_amx || brg1PrcIn1 == Precision::I8 || brg1PrcIn1 == Precision::BF16) {
-        init_brgemm_copy_b(brgCopyBKernel1, batch1 * N1, N1_blk, N1_tail, brgemmCtx1.LDB, brgemmCtx1.K,
+        // values of all the blocks are repacked at once
+        init_brgemm_copy_b(brgCopyBKernel1, batch1 * N1, N1_blk, N1_tail, brgemmCtx1.LDB, useOnlineSoftmax ? K1 : brgemmCtx1.K,
             brgemmCtx1.is_with_amx, brgemmCtx1.dt_in0, brgemmCtx1.dt_in1);
     }
 
     bufferMatMul0In0Size = M_blk * rnd_up(K0, K0_blk) * brg0Prc.size();
     bufferMatMul0In1Size = rnd_up(K0, brg0VnniFactor) * rnd_up(N0, N0_blk) * brg0Prc.size();
-    bufferMatMul0OutSize = brgemmCtx0.M * N0 * accPrecision0.size();
+    bufferMatMul0OutSize = brgemmCtx0.M * S_blk * accPrecision0.size();
     bufferMatMul1In1Size = rnd_up(K1, brg1VnniFactor) * rnd_up(N1, N1_blk) * std::max(brg0Prc.size(), brg1PrcIn1.size());
     bufferMatMul1OutSize = brgemmCtx1.M * N1 * accPrecision1.size();
     bufferCompensation0Size = rnd_up(N0, N0_blk);
     bufferCompensation1Size = rnd_up(N1, N1_blk);
+    // running max and sum of exponents per row
+    bufferSoftmaxStatsSize = 2 * brgemmCtx0.M;
 
     if (brgCopyAKernel0) {
         bufferMatMul0In0.resize(numThreads * bufferMatMul0In0Size);
@@ -1057,6 +1253,9 @@ void MHA::prepareParams() {
     if (brgemmCtx1.is_with_comp) {
         bufferCompensation1.resize(numThreads * bufferCompensation1Size);
     }
+    if (useOnlineSoftmax) {
+        bufferSoftmaxStats.resize(numThreads * bufferSoftmaxStatsSize);
+    }
 
     if (brgemmCtx0.is_with_amx || brgemmCtx1.is_with_amx) {
         wsp.resize(numThreads * wsp_size_per_thread);
@@ -1066,26 +1265,26 @@ void MHA::prepareParams() {
         jit_mul_add_softmax_compile_params jcp;
         jcp.src_prc = accPrecision0;
         jcp.dst_prc = brg1PrcIn0;
-        jcp.work_amount = N0;
+        jcp.work_amount = S_blk;
         jcp.with_mul_scales = !mulScales.empty();
         jcp.is_mul_first = isMulFirst;
         jcp.with_scales0 = !fqScales1.empty();
         jcp.broadcast_scales0 = fqScales1.size() == 1;
         jcp.with_scales1 = !fqScales2.empty();
         jcp.broadcast_scales1 = fqScales2.size() == 1;
+        jcp.is_online = useOnlineSoftmax;
 
-        if (mayiuse(cpu_isa_t::avx512_core)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx512_core>(jcp));
-        } else if (mayiuse(cpu_isa_t::avx2)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx2>(jcp));
-        } else if (mayiuse(cpu_isa_t::sse41)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::sse41>(jcp));
-        } else {
-            THROW_ERROR << "cannot create jit eltwise kernel";
+        mulAddSoftmaxKernel = getMulAddSoftmaxKernel(jcp);
+
+        mulAddSoftmaxTailKernel.reset();
+        if (S_tail) {
+            jcp.work_amount = S_tail;
+            mulAddSoftmaxTailKernel = getMulAddSoftmaxKernel(jcp);
         }
     }
 
-    if (accPrecision1 != getOriginalOutputPrecisionAtPort(0)) {
+    convertReorderKernel.reset();
+    if (useOnlineSoftmax || accPrecision1 != getOriginalOutputPrecisionAtPort(0)) {
         jit_convert_reorder_compile_params jcp;
         jcp.src_prc = accPrecision1;
         jcp.dst_prc = getOriginalOutputPrecisionAtPort(0);
@@ -1095,15 +1294,7 @@ void MHA::prepareParams() {
         jcp.src_stride = N1;
         jcp.dst_stride = batch1 * N1;
 
-        if (mayiuse(cpu_isa_t::avx512_core)) {
-            convertReorderKernel.reset(new jit_convert_reorder_kernel<cpu_isa_t::avx512_core>(jcp));
-        } else if (mayiuse(cpu_isa_t::avx2)) {
-            convertReorderKernel.reset(new jit_convert_reorder_kernel<cpu_isa_t::avx2>(jcp));
-        } else if (mayiuse(cpu_isa_t::sse41)) {
-            convertReorderKernel.reset(new jit_convert_reorder_kernel<cpu_isa_t::sse41>(jcp));
-        } else {
-            THROW_ERROR << "cannot create jit eltwise kernel";
-        }
+        convertReorderKernel = getConvertReorderKernel(jcp);
     }
 
     if (!fqScales0.empty() || inputPrecisions[1] != brg0Prc) {
@@ -1129,12 +1320,6 @@ void MHA::prepareParams() {
         }
     }
 
-    if (mulAddSoftmaxKernel)
-        mulAddSoftmaxKernel->create_ker();
-
-    if (convertReorderKernel)
-        convertReorderKernel->create_ker();
-
     if (convertTransposeKernel)
         convertTransposeKernel->create_ker();
 
@@ -1162,14 +1347,15 @@ static void reorder2D(const srcT* pin, dstT* pout, const std::vector<size_t>& di
     }
 }
 
-void MHA::callBrgemm(brgemmCtx& ctx, std::unique_ptr<brgemm_kernel_t>& brgKernel, const void* pin0, const void* pin1, void* pout, void* wsp) {
+void MHA::callBrgemm(const brgemmKernel& brgKernel, const void* pin0, const void* pin1, void* pout, void* wsp) {
+    const auto& ctx = brgKernel.ctx;
     if (ctx.is_with_amx)
         amx_tile_configure(ctx.palette);
     if (ctx.is_with_comp) {
         brgemm_post_ops_data_t post_ops_data;
-        brgemm_kernel_execute_postops(brgKernel.get(), 1, pin0, pin1, nullptr, pout, pout, post_ops_data, wsp);
+        brgemm_kernel_execute_postops(brgKernel.ker.get(), 1, pin0, pin1, nullptr, pout, pout, post_ops_data, wsp);
     } else {
-        brgemm_kernel_execute(brgKernel.get(), 1, pin0, pin1, nullptr, pout, wsp);
+        brgemm_kernel_execute(brgKernel.ker.get(), 1, pin0, pin1, nullptr, pout, wsp);
     }
 }
 
@@ -1189,7 +1375,7 @@ void MHA::mhaImpl() {
         auto pTranspose0In0_aux = pTranspose0In0 + (i0 * strTranspose0In0[0] + i1 * strTranspose0In0[2]) * inputPrecisions[0].size(); // order 0213
         auto pTranspose1In0_aux = pTranspose1In0 + (i0 * strTranspose1In0[0] + i1 * strTranspose1In0[2]) * inputPrecisions[1].size(); // order 0231
 
-        auto pAddIn1_aux = pAddIn1 + i0 * strAddIn1[0]; // order 0231
+        auto pAddIn1_aux = pAddIn1 + (dimsAddIn1[0] == 1 ? 0 : i0) * strAddIn1[0]; // order 0231
 
         auto bufferMatMul0In1_local = reinterpret_cast<uint8_t*>(bufferMatMul0In1.data() + threadNum * bufferMatMul0In1Size);
         auto bufferMatMul0Out_local = reinterpret_cast<uint8_t*>(bufferMatMul0Out.data() + threadNum * bufferMatMul0OutSize);
@@ -1300,6 +1486,103 @@ void MHA::mhaImpl() {
             // }
 
             auto pMatMul0Out = bufferMatMul0Out_local;
+            auto pOut_aux = pout + (i0 * strOut[0] + i1 * strOut[2]) * outPrcSize;
+
+            if (useOnlineSoftmax) {
+                size_t mIdx = is_M_tail ? 1 : 0;
+                auto pMulIn1 = reinterpret_cast<float*>(mulScales.empty() ? nullptr : mulScales.data());
+                auto pAcc = reinterpret_cast<float*>(bufferMatMul1Out_local);
+                auto pMax = bufferSoftmaxStats.data() + threadNum * bufferSoftmaxStatsSize;
+                auto pSum = pMax + cur_M_blk;
+
+                std::fill(pAcc, pAcc + cur_M_blk * N1, 0.f);
+                std::fill(pMax, pMax + cur_M_blk, std::numeric_limits<float>::lowest());
+                std::fill(pSum, pSum + cur_M_blk, 0.f);
+
+                for (size_t sb = 0; sb < div_up(N0, S_blk); sb++) {
+                    const bool is_S_tail = (N0 - sb * S_blk < S_blk);
+                    size_t sIdx = is_S_tail ? 1 : 0;
+
+                    const auto& brgemmCtx0 = brgCtxs0[getBrgIdx(0, 0, 0, sIdx)];
+                    size_t K0_step0 = brgemmCtx0.K;
+                    size_t K0_step1 = brgemmCtx0.K * brgemmCtx0.LDB;
+                    size_t N0_step0 = brgemmCtx0.N * brg0VnniFactor;
+                    size_t N0_step1 = brgemmCtx0.N;
+                    auto pKeys = pMatMul0In1 + sb * S_blk * brg0VnniFactor * inputPrecisions[0].size();
+                    for (size_t n = 0; n < 2; n++) {
+                        for (size_t k = 0; k < 2; k++) {
+                            const auto& brgKernel = brgKernels0[getBrgIdx(mIdx, k, n, sIdx)];
+                            if (brgKernel) {
+                                callBrgemm(*brgKernel,
+                                    pMatMul0In0 + (k * K0_step0) * inputPrecisions[0].size(), pKeys + (k * K0_step1 + n * N0_step0) * inputPrecisions[0].size(),
+                                    pMatMul0Out + (n * N0_step1) * accPrecision0.size(), wsp_local);
+                            }
+                        }
+                    }
+
+                    const auto& softmaxKernel = is_S_tail ? mulAddSoftmaxTailKernel : mulAddSoftmaxKernel;
+                    for (size_t m = 0; m < cur_M_blk; m++) {
+                        const float prevMax = pMax[m];
+                        float blockSum = 0.f;
+
+                        jit_mul_add_softmax_call_args call_args;
+                        call_args.p_in0 = pMatMul0Out + m * S_blk * accPrecision0.size();
+                        call_args.p_mul_in1 = mulScales.size() > 1 ? pMulIn1 + i1 : pMulIn1;
+                        call_args.p_add_in1 = pAddIn1_aux + sb * S_blk;
+                        call_args.p_out = pMatMul0Out + m * S_blk * inputPrecisions[3].size();
+                        call_args.p_buffer = pMatMul0Out + m * S_blk * accPrecision0.size();
+                        call_args.p_scales0 = fqScales1.data();
+                        call_args.p_scales1 = fqScales2.data();
+                        call_args.p_max = pMax + m;
+                        call_args.p_sum = &blockSum;
+
+                        (*softmaxKernel)(&call_args);
+
+                        // the row results of the previous blocks were accumulated with the outdated max
+                        const float scale = std::exp(prevMax - pMax[m]);
+                        pSum[m] = pSum[m] * scale + blockSum;
+                        if (sb != 0 && scale != 1.f) {
+                            auto pAccRow = pAcc + m * N1;
+                            for (size_t n = 0; n < N1; n++)
+                                pAccRow[n] *= scale;
+                        }
+                    }
+
+                    const auto& brgemmCtx1 = brgCtxs1[getBrgIdx(0, 0, 0, sIdx)];
+                    size_t K1_step0 = brgemmCtx1.K;
+                    size_t K1_step1 = brgemmCtx1.K * brgemmCtx1.LDB;
+                    size_t N1_step0 = brgemmCtx1.N * brg1VnniFactor;
+                    size_t N1_step1 = brgemmCtx1.N;
+                    auto pValues = pMatMul1In1 + sb * S_blk * brgemmCtx1.LDB * inputPrecisions[3].size();
+                    for (size_t n = 0; n < 2; n++) {
+                        for (size_t k = 0; k < 2; k++) {
+                            const auto& brgKernel = brgKernels1[getBrgIdx(mIdx, k, n, sIdx)];
+                            if (brgKernel) {
+                                callBrgemm(*brgKernel,
+                                    pMatMul0Out + (k * K1_step0) * inputPrecisions[3].size(), pValues + (k * K1_step1 + n * N1_step0) * inputPrecisions[3].size(),
+                                    pAcc + n * N1_step1, wsp_local);
+                            }
+                        }
+                    }
+                }
+
+                for (size_t m = 0; m < cur_M_blk; m++) {
+                    const float denom = 1.f / pSum[m];
+                    auto pAccRow = pAcc + m * N1;
+                    for (size_t n = 0; n < N1; n++)
+                        pAccRow[n] *= denom;
+                }
+
+                jit_convert_reorder_call_args call_args;
+                call_args.p_in = pAcc;
+                call_args.p_out = pOut_aux + (mb * M_blk * batch1 * N1) * outPrcSize;
+                call_args.p_scales = fqScales3.data();
+                call_args.outter_work_amount = cur_M_blk;
+
+                (*convertReorderKernel)(&call_args);
+
+                continue;
+            }
 
             size_t brgIdx0 = getBrgIdx(0, 0, 0);
             size_t K0_step0 = brgCtxs0[brgIdx0].K;
@@ -1316,7 +1599,7 @@ void MHA::mhaImpl() {
                         : reinterpret_cast<void*>(wsp_local);
 
                     if (brgemmCtx.K != 0 && brgemmCtx.N != 0) {
-                        callBrgemm(brgemmCtx, brgKernels0[getBrgIdx(mIdx, k, n)],
+                        callBrgemm(*brgKernels0[getBrgIdx(mIdx, k, n)],
                             pMatMul0In0 + (k * K0_step0) * inputPrecisions[0].size(), pMatMul0In1 + (k * K0_step1 + n * N0_step0) * inputPrecisions[0].size(),
                             pMatMul0Out + (n * N0_step1) * accPrecision0.size(), wsp);
                     }
@@ -1338,7 +1621,6 @@ void MHA::mhaImpl() {
             }
 
             auto pMatMul1In0 = bufferMatMul0Out_local;
-            auto pOut_aux = pout + (i0 * strOut[0] + i1 * strOut[2]) * outPrcSize;
 
             auto pMatMul1Out = getOriginalOutputPrecisionAtPort(0) == Precision::FP32
                 ? pOut_aux + (mb * M_blk * batch1 * N1) * outPrcSize
@@ -1359,7 +1641,7 @@ void MHA::mhaImpl() {
                         : reinterpret_cast<void*>(wsp_local);
 
                     if (brgemmCtx.K != 0 && brgemmCtx.N != 0) {
-                        callBrgemm(brgemmCtx, brgKernels1[getBrgIdx(mIdx, k, n)],
+                        callBrgemm(*brgKernels1[getBrgIdx(mIdx, k, n)],
                             pMatMul1In0 + (k * K1_step0) * inputPrecisions[3].size(), pMatMul1In1 + (k * K1_step1 + n * N1_step0) * inputPrecisions[3].size(),
                             pMatMul1Out + (n * N1_step1) * accPrecision1.size(), wsp);
                     }
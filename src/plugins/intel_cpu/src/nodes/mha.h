@@ -28,6 +28,9 @@ struct jit_mul_add_softmax_compile_params {
     bool broadcast_scales0;
     bool with_scales1;
     bool broadcast_scales1;
+    // the row is a block of the whole softmax axis: the running max is updated, the sum of exponents is returned
+    // and the result is not normalized
+    bool is_online;
 };
 
 struct jit_mul_add_softmax_call_args {
@@ -38,6 +41,8 @@ struct jit_mul_add_softmax_call_args {
     void *p_buffer;
     const void *p_scales0;
     const void *p_scales1;
+    float *p_max;
+    float *p_sum;
 };
 
 struct jit_uni_mul_add_softmax_kernel {
@@ -123,7 +128,7 @@ struct jit_uni_convert_transpose_kernel {
     jit_convert_transpose_compile_params jcp_;
 };
 
-#define MHA_BRGEMM_KERNELS_NUM 8
+#define MHA_BRGEMM_KERNELS_NUM 16
 
 class MHA : public Node {
 public:
@@ -150,20 +155,28 @@ private:
         float beta;
     };
 
+    struct brgemmKernel {
+        brgemmCtx ctx;
+        std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> ker;
+    };
+
     template <typename in1_type>
     void mhaImpl();
 
     void init_brgemm(brgemmCtx& ctx, std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>& brgKernel, bool use_amx);
+    std::shared_ptr<brgemmKernel> getBrgemmKernel(brgemmCtx& ctx, bool use_amx);
+    std::shared_ptr<jit_uni_mul_add_softmax_kernel> getMulAddSoftmaxKernel(const jit_mul_add_softmax_compile_params& jcp);
+    std::shared_ptr<jit_uni_convert_reorder_kernel> getConvertReorderKernel(const jit_convert_reorder_compile_params& jcp);
     void init_brgemm_copy_a(std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_a_t>& brgCopyKernel,
         size_t K, size_t K_blk, size_t K_tail, size_t LDA, dnnl_data_type_t dt_in0);
     void init_brgemm_copy_b(std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t>& brgCopyKernel,
         size_t N, size_t N_blk, size_t N_tail, size_t LDB, size_t K, bool is_with_amx, dnnl_data_type_t dt_in0, dnnl_data_type_t dt_in1);
 
-    void callBrgemm(brgemmCtx& ctx, std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>& brgKernel,
-                    const void* pin0, const void* pin1, void* pout, void* wsp);
+    void callBrgemm(const brgemmKernel& brgKernel, const void* pin0, const void* pin1, void* pout, void* wsp);
 
-    size_t getBrgIdx(size_t mIdx, size_t kIdx, size_t nIdx) {
-        return mIdx * 4 + kIdx * 2 + nIdx;
+    // sIdx selects the tiles of the key/value sequence tail block
+    size_t getBrgIdx(size_t mIdx, size_t kIdx, size_t nIdx, size_t sIdx = 0) {
+        return sIdx * 8 + mIdx * 4 + kIdx * 2 + nIdx;
     }
 
     std::vector<InferenceEngine::Precision> inputPrecisions;
@@ -194,6 +207,10 @@ private:
     size_t M, M_blk, M_tail;
     size_t K0, K0_blk, K0_tail, N0, N0_blk, N0_tail;
     size_t K1, K1_blk, K1_tail, N1, N1_blk, N1_tail;
+    size_t S_blk, S_tail;
+
+    // Keys and values are processed by S_blk blocks, the softmax is computed online by rescaling the partial results
+    bool useOnlineSoftmax = false;
 
     size_t bufferMatMul0In0Size;
     size_t bufferMatMul0In1Size;
@@ -202,6 +219,7 @@ private:
     size_t bufferMatMul1OutSize;
     size_t bufferCompensation0Size;
     size_t bufferCompensation1Size;
+    size_t bufferSoftmaxStatsSize;
     size_t wsp_size_per_thread = 4 * 1024;
 
     std::vector<uint8_t> bufferMatMul0In0;
@@ -211,6 +229,7 @@ private:
     std::vector<uint8_t> bufferMatMul1Out;
     std::vector<int32_t> bufferCompensation0;
     std::vector<int32_t> bufferCompensation1;
+    std::vector<float> bufferSoftmaxStats;
     std::vector<size_t> wsp;
 
     bool isMulFirst;
@@ -224,17 +243,18 @@ private:
 
     size_t brg0VnniFactor;
     brgemmCtx brgCtxs0[MHA_BRGEMM_KERNELS_NUM];
-    std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> brgKernels0[MHA_BRGEMM_KERNELS_NUM];
+    std::shared_ptr<brgemmKernel> brgKernels0[MHA_BRGEMM_KERNELS_NUM];
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_a_t> brgCopyAKernel0;
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t> brgCopyBKernel0;
 
     size_t brg1VnniFactor;
     brgemmCtx brgCtxs1[MHA_BRGEMM_KERNELS_NUM];
-    std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> brgKernels1[MHA_BRGEMM_KERNELS_NUM];
+    std::shared_ptr<brgemmKernel> brgKernels1[MHA_BRGEMM_KERNELS_NUM];
     std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t> brgCopyBKernel1;
 
-    std::unique_ptr<jit_uni_mul_add_softmax_kernel> mulAddSoftmaxKernel;
-    std::unique_ptr<jit_uni_convert_reorder_kernel> convertReorderKernel;
+    std::shared_ptr<jit_uni_mul_add_softmax_kernel> mulAddSoftmaxKernel;
+    std::shared_ptr<jit_uni_mul_add_softmax_kernel> mulAddSoftmaxTailKernel;
+    std::shared_ptr<jit_uni_convert_reorder_kernel> convertReorderKernel;
     std::unique_ptr<jit_uni_convert_transpose_kernel> convertTransposeKernel;
 };
 
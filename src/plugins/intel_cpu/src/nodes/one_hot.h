@@ -27,6 +27,7 @@ public:
 
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    bool isShapeInferReusable() const override { return !hasNonConstInputs(PortMask(1)); }
     bool needPrepareParams() const override { return false; };
     void executeDynamicImpl(dnnl::stream strm) override;
 
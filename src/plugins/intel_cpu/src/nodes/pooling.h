@@ -31,6 +31,8 @@ public:
 
     void prepareParams() override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    // the paddings are taken from the shape inference
+    bool isShapeInferReusable() const override { return !auto_pad && Node::isShapeInferReusable(); }
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
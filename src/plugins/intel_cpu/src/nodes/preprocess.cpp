@@ -0,0 +1,474 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "preprocess.h"
+#include <utils/general_utils.h>
+#include <cpu/x64/jit_generator.hpp>
+#include "emitters/jit_load_store_emitters.hpp"
+#include "ngraph_transformations/op/preprocess.hpp"
+
+using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
+
+#define THROW_ERROR IE_THROW() << getTypeStr() << " node with name '" << getName() << "' "
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+// the number of pixels processed by one task
+constexpr size_t spatialChunk = 2048;
+}   // namespace
+
+template <cpu_isa_t isa>
+struct jit_preprocess_kernel : public jit_uni_preprocess_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_preprocess_kernel)
+
+    explicit jit_preprocess_kernel(const jit_preprocess_compile_params& jcp) : jit_uni_preprocess_kernel(jcp), jit_generator() {
+        vec_size = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+    }
+    virtual ~jit_preprocess_kernel() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == cpu_isa_t::sse41, Xmm, isa == cpu_isa_t::avx2, Ymm, Zmm>::type;
+
+    void generate() override {
+        this->preamble();
+
+#define GET_OFF(field) offsetof(jit_preprocess_call_args, field)
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        mov(reg_shifts, ptr[reg_params + GET_OFF(shifts)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_src_lane_stride, ptr[reg_params + GET_OFF(src_lane_stride)]);
+        mov(reg_src_step, ptr[reg_params + GET_OFF(src_step)]);
+        mov(reg_dst_step, ptr[reg_params + GET_OFF(dst_step)]);
+#undef GET_OFF
+
+        if (jcp_.channel_lanes) {
+            channel_lanes_loop();
+        } else {
+            pixel_lanes_loop();
+        }
+
+        this->postamble();
+
+        for (const auto& emitter : emitters) {
+            if (emitter.second)
+                emitter.second->emit_data();
+        }
+    }
+
+    // one channel, the vector lanes are the neighbour pixels
+    void pixel_lanes_loop() {
+        Xbyak::Label vector_loop_label;
+        Xbyak::Label vector_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_end_label;
+
+        uni_vbroadcastss(vmm_scales, ptr[reg_scales]);
+        uni_vbroadcastss(vmm_shifts, ptr[reg_shifts]);
+
+        L(vector_loop_label);
+        {
+            cmp(reg_work_amount, vec_size);
+            jl(vector_end_label, T_NEAR);
+
+            if (jcp_.contiguous_lanes) {
+                load(vmm_val, reg_src, jcp_.src_prc, Precision::FP32, vec_size, false);
+                add(reg_src, jcp_.src_prc.size() * vec_size);
+            } else {
+                load_strided(vec_size, false);
+                mov(reg_src, reg_src_aux);
+            }
+            uni_vfmadd213ps(vmm_val, vmm_scales, vmm_shifts);
+            store(reg_dst, vmm_val, Precision::FP32, jcp_.dst_prc, vec_size);
+            add(reg_dst, jcp_.dst_prc.size() * vec_size);
+
+            sub(reg_work_amount, vec_size);
+            jmp(vector_loop_label, T_NEAR);
+        }
+        L(vector_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_end_label, T_NEAR);
+
+            load(vmm_val, reg_src, jcp_.src_prc, Precision::FP32, 1, false);
+            uni_vfmadd213ps(vmm_val, vmm_scales, vmm_shifts);
+            store(reg_dst, vmm_val, Precision::FP32, jcp_.dst_prc, 1);
+            add(reg_src, reg_src_lane_stride);
+            add(reg_dst, jcp_.dst_prc.size());
+
+            dec(reg_work_amount);
+            jmp(tail_loop_label, T_NEAR);
+        }
+        L(tail_end_label);
+    }
+
+    // one pixel per iteration, the vector lanes are the channels of the block
+    void channel_lanes_loop() {
+        Xbyak::Label loop_label;
+        Xbyak::Label end_label;
+
+        load(vmm_scales, reg_scales, Precision::FP32, Precision::FP32, jcp_.store_num, true);
+        load(vmm_shifts, reg_shifts, Precision::FP32, Precision::FP32, jcp_.store_num, true);
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(end_label, T_NEAR);
+
+            if (jcp_.contiguous_lanes) {
+                load(vmm_val, reg_src, jcp_.src_prc, Precision::FP32, jcp_.load_num, true);
+            } else {
+                load_strided(jcp_.load_num, true);
+            }
+            // the padding lanes are zero: both the data and the scales/shifts are filled with zeros
+            uni_vfmadd213ps(vmm_val, vmm_scales, vmm_shifts);
+            store(reg_dst, vmm_val, Precision::FP32, jcp_.dst_prc, jcp_.store_num);
+            add(reg_src, reg_src_step);
+            add(reg_dst, reg_dst_step);
+
+            dec(reg_work_amount);
+            jmp(loop_label, T_NEAR);
+        }
+        L(end_label);
+    }
+
+    // gathers the lanes which are reg_src_lane_stride bytes apart on the stack, reg_src_aux points to the next lane after
+    void load_strided(size_t lanes, bool fill) {
+        const auto src_size = jcp_.src_prc.size();
+        sub(rsp, src_size * vec_size);
+        mov(reg_src_aux, reg_src);
+        for (size_t i = 0; i < lanes; i++) {
+            if (src_size == 4) {
+                mov(reg_tmp_32, ptr[reg_src_aux]);
+                mov(ptr[rsp + i * src_size], reg_tmp_32);
+            } else if (src_size == 2) {
+                mov(reg_tmp_16, ptr[reg_src_aux]);
+                mov(ptr[rsp + i * src_size], reg_tmp_16);
+            } else if (src_size == 1) {
+                mov(reg_tmp_8, ptr[reg_src_aux]);
+                mov(ptr[rsp + i * src_size], reg_tmp_8);
+            }
+            add(reg_src_aux, reg_src_lane_stride);
+        }
+        load(vmm_val, rsp, jcp_.src_prc, Precision::FP32, lanes, fill);
+        add(rsp, src_size * vec_size);
+    }
+
+    inline void load(const Vmm& vmm_dst, const Xbyak::Reg64& reg_src, Precision src_prc, Precision dst_prc, const int& elt_num, bool fill) {
+        const auto seed = load_emitter_params(src_prc, dst_prc, elt_num, fill, "zero").hash();
+        if (!emitters[seed]) {
+            emitters[seed].reset(new jit_load_emitter(this, isa, src_prc, dst_prc, elt_num, Precision::FP32, fill, "zero"));
+        }
+
+        emitters[seed]->emit_code({static_cast<size_t>(reg_src.getIdx()), 0}, {static_cast<size_t>(vmm_dst.getIdx())},
+                                  pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+    }
+    inline void store(const Xbyak::Reg64& reg_dst, const Vmm& vmm_src, Precision src_prc, Precision dst_prc, const int& elt_num) {
+        const auto seed = store_emitter_params(src_prc, dst_prc, elt_num).hash();
+        if (!emitters[seed]) {
+            emitters[seed].reset(new jit_store_emitter(this, isa, src_prc, dst_prc, elt_num));
+        }
+
+        emitters[seed]->emit_code({static_cast<size_t>(vmm_src.getIdx()), 0}, {static_cast<size_t>(reg_dst.getIdx())},
+                                  pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+    }
+
+    size_t vec_size;
+
+    Vmm vmm_scales = Vmm(0);
+    Vmm vmm_shifts = Vmm(1);
+    Vmm vmm_val = Vmm(2);
+    Vmm vmm_aux0 = Vmm(3);
+    Vmm vmm_aux1 = Vmm(4);
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_scales = r10;
+    Reg64 reg_shifts = r11;
+    Reg64 reg_work_amount = r12;
+    Reg64 reg_src_lane_stride = r13;
+    Reg64 reg_src_step = r14;
+    Reg64 reg_dst_step = r15;
+    Reg64 reg_src_aux = rax;
+    Reg8 reg_tmp_8 = Reg8(rbx.getIdx());
+    Reg16 reg_tmp_16 = Reg16(rbx.getIdx());
+    Reg32 reg_tmp_32 = Reg32(rbx.getIdx());
+    Reg64 reg_params = abi_param1;
+
+    const std::vector<size_t> pool_aux_gpr_idxs = { static_cast<size_t>(rsi.getIdx()), static_cast<size_t>(rbp.getIdx()) };
+    const std::vector<size_t> pool_aux_vmm_idxs = { static_cast<size_t>(vmm_aux0.getIdx()), static_cast<size_t>(vmm_aux1.getIdx()) };
+
+    std::unordered_map<size_t, std::unique_ptr<jit_emitter>> emitters;
+};
+
+bool Preprocess::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto preprocess = std::dynamic_pointer_cast<const PreprocessNode>(op);
+        if (!preprocess) {
+            errorMessage = "Only Preprocess operation from CPU internal opset is supported";
+            return false;
+        }
+        if (preprocess->get_input_partial_shape(0).rank().get_length() != 4) {
+            errorMessage = "Doesn't support input with rank: " + std::to_string(preprocess->get_input_partial_shape(0).rank().get_length());
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+Preprocess::Preprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
+        : Node(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    const auto preprocess = std::dynamic_pointer_cast<const PreprocessNode>(op);
+    scales = preprocess->get_scales();
+    shifts = preprocess->get_shifts();
+    channelsLastInput = preprocess->is_channels_last_input();
+}
+
+void Preprocess::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrc = getOriginalInputPrecisionAtPort(0);
+    if (!one_of(srcPrc, Precision::U8, Precision::I8, Precision::FP32))
+        srcPrc = Precision::FP32;
+    // f32 -> bf16 store requires avx512_core
+    dstPrc = getOriginalOutputPrecisionAtPort(0) == Precision::BF16 && mayiuse(avx512_core) ? Precision::BF16 : Precision::FP32;
+
+    impl_desc_type implType;
+    LayoutType blockedLayout = LayoutType::ncsp;
+    if (mayiuse(avx512_core)) {
+        implType = impl_desc_type::jit_avx512;
+        blockedLayout = LayoutType::nCsp16c;
+    } else if (mayiuse(avx2)) {
+        implType = impl_desc_type::jit_avx2;
+        blockedLayout = LayoutType::nCsp8c;
+    } else if (mayiuse(sse41)) {
+        implType = impl_desc_type::jit_sse42;
+    } else {
+        implType = impl_desc_type::ref;
+    }
+
+    // in the order of preference: the convolution takes the images with less than 4 channels in the planar layout
+    // and the wider inputs in the blocked one
+    std::vector<LayoutType> dstLayouts;
+    if (scales.size() < 4) {
+        dstLayouts = {LayoutType::ncsp, LayoutType::nspc};
+        if (blockedLayout != LayoutType::ncsp)
+            dstLayouts.push_back(blockedLayout);
+    } else {
+        if (blockedLayout != LayoutType::ncsp)
+            dstLayouts.push_back(blockedLayout);
+        dstLayouts.push_back(LayoutType::nspc);
+        dstLayouts.push_back(LayoutType::ncsp);
+    }
+
+    for (const auto dstLayout : dstLayouts) {
+        addSupportedPrimDesc({{LayoutType::ncsp, srcPrc}},
+                             {{dstLayout, dstPrc}},
+                             implType);
+    }
+}
+
+void Preprocess::createPrimitive() {
+    const NodeDesc *desc = getSelectedPrimitiveDescriptor();
+    if (!desc)
+        THROW_ERROR << "has no optimal primitive descriptor selected";
+
+    const auto& dstDesc = desc->getConfig().outConfs[0].getMemDesc();
+    for (const auto layout : {LayoutType::nCsp16c, LayoutType::nCsp8c, LayoutType::nspc, LayoutType::ncsp}) {
+        if (dstDesc->hasLayoutType(layout)) {
+            dstLayout = layout;
+            break;
+        }
+    }
+    createKernels();
+
+    Node::createPrimitive();
+}
+
+void Preprocess::createKernels() {
+    if (mayiuse(avx512_core)) {
+        vecSize = cpu_isa_traits<avx512_core>::vlen / sizeof(float);
+    } else if (mayiuse(avx2)) {
+        vecSize = cpu_isa_traits<avx2>::vlen / sizeof(float);
+    } else if (mayiuse(sse41)) {
+        vecSize = cpu_isa_traits<sse41>::vlen / sizeof(float);
+    } else {
+        return;
+    }
+
+    const auto channels = scales.size();
+    const size_t blockSize = dstLayout == LayoutType::nCsp16c ? 16 : dstLayout == LayoutType::nCsp8c ? 8 : vecSize;
+    const size_t blocksNum = div_up(channels, blockSize);
+    blockedScales.assign(blocksNum * blockSize, 0.f);
+    blockedShifts.assign(blocksNum * blockSize, 0.f);
+    std::copy(scales.begin(), scales.end(), blockedScales.begin());
+    std::copy(shifts.begin(), shifts.end(), blockedShifts.begin());
+
+    auto create = [&](const jit_preprocess_compile_params& jcp) {
+        std::shared_ptr<jit_uni_preprocess_kernel> result;
+        if (mayiuse(avx512_core)) {
+            result.reset(new jit_preprocess_kernel<avx512_core>(jcp));
+        } else if (mayiuse(avx2)) {
+            result.reset(new jit_preprocess_kernel<avx2>(jcp));
+        } else {
+            result.reset(new jit_preprocess_kernel<sse41>(jcp));
+        }
+        result->create_ker();
+        return result;
+    };
+
+    jit_preprocess_compile_params jcp;
+    jcp.src_prc = srcPrc;
+    jcp.dst_prc = dstPrc;
+    if (dstLayout == LayoutType::ncsp) {
+        jcp.channel_lanes = false;
+        jcp.contiguous_lanes = !channelsLastInput;
+        jcp.load_num = jcp.store_num = vecSize;
+        kernel = create(jcp);
+        return;
+    }
+
+    const bool isBlocked = dstLayout != LayoutType::nspc;
+    jcp.channel_lanes = true;
+    jcp.contiguous_lanes = channelsLastInput;
+    jcp.load_num = std::min(blockSize, channels);
+    jcp.store_num = isBlocked ? blockSize : jcp.load_num;
+    kernel = create(jcp);
+    if (channels % blockSize != 0 && channels > blockSize) {
+        jcp.load_num = channels % blockSize;
+        jcp.store_num = isBlocked ? blockSize : jcp.load_num;
+        tailKernel = create(jcp);
+    }
+}
+
+Preprocess::Geometry Preprocess::getGeometry() const {
+    const auto& dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    Geometry geometry;
+    geometry.batch = dstDims[0];
+    geometry.channels = dstDims[1];
+    geometry.spatial = dstDims[2] * dstDims[3];
+    geometry.srcPixelStride = channelsLastInput ? geometry.channels : 1;
+    geometry.srcChannelStride = channelsLastInput ? 1 : geometry.spatial;
+    geometry.blockSize = dstLayout == LayoutType::nCsp16c ? 16 : dstLayout == LayoutType::nCsp8c ? 8 :
+                         dstLayout == LayoutType::nspc ? geometry.channels : 1;
+    return geometry;
+}
+
+void Preprocess::execute(dnnl::stream strm) {
+    const auto geometry = getGeometry();
+    if (kernel) {
+        executeJit(geometry);
+    } else if (srcPrc == Precision::U8) {
+        executeRef<uint8_t>(geometry);
+    } else if (srcPrc == Precision::I8) {
+        executeRef<int8_t>(geometry);
+    } else {
+        executeRef<float>(geometry);
+    }
+}
+
+void Preprocess::executeJit(const Geometry& geometry) {
+    const auto* src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto* dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto srcSize = srcPrc.size();
+    const auto dstSize = dstPrc.size();
+    const auto& channels = geometry.channels;
+    const auto& spatial = geometry.spatial;
+    const size_t chunks = div_up(spatial, spatialChunk);
+
+    if (dstLayout == LayoutType::ncsp) {
+        parallel_for3d(geometry.batch, channels, chunks, [&](size_t n, size_t c, size_t chunk) {
+            const auto begin = chunk * spatialChunk;
+            jit_preprocess_call_args args;
+            args.src = src + (n * channels * spatial + c * geometry.srcChannelStride + begin * geometry.srcPixelStride) * srcSize;
+            args.dst = dst + ((n * channels + c) * spatial + begin) * dstSize;
+            args.scales = &scales[c];
+            args.shifts = &shifts[c];
+            args.work_amount = std::min(spatialChunk, spatial - begin);
+            args.src_lane_stride = geometry.srcPixelStride * srcSize;
+            args.src_step = 0;
+            args.dst_step = 0;
+            (*kernel)(&args);
+        });
+        return;
+    }
+
+    // the channels processed by one kernel call: the block of the blocked layout or a vector of the channels last one
+    const bool isBlocked = dstLayout != LayoutType::nspc;
+    const size_t callChannels = isBlocked ? geometry.blockSize : std::min(vecSize, channels);
+    const size_t blocksNum = div_up(channels, callChannels);
+    parallel_for2d(geometry.batch, chunks, [&](size_t n, size_t chunk) {
+        const auto begin = chunk * spatialChunk;
+        jit_preprocess_call_args args;
+        args.work_amount = std::min(spatialChunk, spatial - begin);
+        args.src_lane_stride = geometry.srcChannelStride * srcSize;
+        args.src_step = geometry.srcPixelStride * srcSize;
+        args.dst_step = (isBlocked ? geometry.blockSize : channels) * dstSize;
+        for (size_t block = 0; block < blocksNum; block++) {
+            const auto c = block * callChannels;
+            args.src = src + (n * channels * spatial + begin * geometry.srcPixelStride + c * geometry.srcChannelStride) * srcSize;
+            args.dst = isBlocked ? dst + ((n * blocksNum + block) * spatial + begin) * geometry.blockSize * dstSize
+                                 : dst + ((n * spatial + begin) * channels + c) * dstSize;
+            args.scales = &blockedScales[c];
+            args.shifts = &blockedShifts[c];
+            const auto& blockKernel = block == blocksNum - 1 && tailKernel ? tailKernel : kernel;
+            (*blockKernel)(&args);
+        }
+    });
+}
+
+template <typename T>
+void Preprocess::executeRef(const Geometry& geometry) {
+    const auto* src = reinterpret_cast<const T*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto* dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto& channels = geometry.channels;
+    const auto& spatial = geometry.spatial;
+    // the reference implementation is used without the blocked layouts
+    const bool isPlanar = dstLayout == LayoutType::ncsp;
+    parallel_for2d(geometry.batch, channels, [&](size_t n, size_t c) {
+        const auto* srcChannel = src + n * channels * spatial + c * geometry.srcChannelStride;
+        auto* dstChannel = isPlanar ? dst + (n * channels + c) * spatial : dst + n * spatial * channels + c;
+        const size_t dstStride = isPlanar ? 1 : channels;
+        for (size_t p = 0; p < spatial; p++) {
+            dstChannel[p * dstStride] = static_cast<float>(srcChannel[p * geometry.srcPixelStride]) * scales[c] + shifts[c];
+        }
+    });
+}
+
+void Preprocess::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool Preprocess::created() const {
+    return getType() == Type::Preprocess;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
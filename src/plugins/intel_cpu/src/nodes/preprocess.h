@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+struct jit_preprocess_compile_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    // the vector lanes are the channels of one pixel, otherwise they are the pixels of one channel
+    bool channel_lanes;
+    // the source lanes are adjacent in memory, otherwise they are src_lane_stride bytes apart
+    bool contiguous_lanes;
+    // channel lanes only: the number of the channels in the block and the number of the stored lanes,
+    // the lanes above load_num are stored as zeros (the padding of the blocked layouts)
+    size_t load_num;
+    size_t store_num;
+};
+
+struct jit_preprocess_call_args {
+    const void *src;
+    void *dst;
+    // channel lanes: per-lane values padded with zeros up to store_num, otherwise the values of the channel
+    const float *scales;
+    const float *shifts;
+    size_t work_amount;         // pixels
+    size_t src_lane_stride;     // bytes
+    size_t src_step;            // channel lanes: bytes between the pixels
+    size_t dst_step;            // channel lanes: bytes between the pixels
+};
+
+struct jit_uni_preprocess_kernel {
+    void (*ker_)(const jit_preprocess_call_args*);
+
+    void operator()(const jit_preprocess_call_args* call_args) {
+        assert(ker_);
+        ker_(call_args);
+    }
+
+    explicit jit_uni_preprocess_kernel(const jit_preprocess_compile_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_preprocess_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_preprocess_compile_params jcp_;
+};
+
+/**
+ * @brief Executes the preprocessing of the model input in a single pass: the source (u8/i8/f32, NCHW or NHWC)
+ * is converted to f32, scaled and shifted per channel and written in the planar, channels last or blocked layout
+ * which is preferred by the consumer.
+ */
+class Preprocess : public Node {
+public:
+    Preprocess(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    bool needPrepareParams() const override { return false; }
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    struct Geometry {
+        size_t batch, channels, spatial;
+        size_t srcPixelStride, srcChannelStride;
+        size_t blockSize;   // 1 - planar output, channels - channels last output
+    };
+
+    Geometry getGeometry() const;
+    void createKernels();
+    void executeJit(const Geometry& geometry);
+    template <typename T>
+    void executeRef(const Geometry& geometry);
+
+    std::vector<float> scales;
+    std::vector<float> shifts;
+    // per-block values padded with zeros up to the block size
+    std::vector<float> blockedScales;
+    std::vector<float> blockedShifts;
+    bool channelsLastInput = false;
+
+    InferenceEngine::Precision srcPrc;
+    InferenceEngine::Precision dstPrc;
+    LayoutType dstLayout = LayoutType::ncsp;
+    size_t vecSize = 1;
+    std::shared_ptr<jit_uni_preprocess_kernel> kernel;
+    std::shared_ptr<jit_uni_preprocess_kernel> tailKernel;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -26,6 +26,7 @@ public:
 
     bool needShapeInfer() const override;
     std::vector<VectorDims> shapeInfer() const override;
+    bool isShapeInferReusable() const override { return !hasNonConstInputs(PortMask(0)); }
     bool needPrepareParams() const override;
 
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
@@ -16,6 +16,7 @@
 #include <dnnl_extension_utils.h>
 
 #include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset6.hpp>
 #include <ngraph/pass/visualize_tree.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -23,6 +24,7 @@
 #include <snippets/op/subgraph.hpp>
 #include "emitters/cpu_generator.hpp"
 #include "snippets_transformations/fuse_load_store_and_convert.hpp"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace InferenceEngine;
 using namespace dnnl::impl::utils;
@@ -34,27 +36,140 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+struct SnippetKey {
+    std::shared_ptr<ov::Model> body;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputShapes;
+
+    size_t hash() const;
+    bool operator==(const SnippetKey& rhs) const;
+};
+
+size_t SnippetKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    auto hash_blocked_shape = [](size_t seed, const ngraph::snippets::op::Subgraph::BlockedShape& blockedShape) {
+        for (const auto& d : std::get<0>(blockedShape))
+            seed = hash_combine(seed, d);
+        for (const auto& o : std::get<1>(blockedShape))
+            seed = hash_combine(seed, o);
+        return hash_combine(seed, std::get<2>(blockedShape).hash());
+    };
+
+    // the body is kept alive by the key, so its address uniquely identifies the subgraph
+    size_t seed = hash_combine(0, body.get());
+    for (const auto& shape : inputShapes)
+        seed = hash_blocked_shape(seed, shape);
+    for (const auto& shape : outputShapes)
+        seed = hash_blocked_shape(seed, shape);
+    return seed;
+}
+
+bool SnippetKey::operator==(const SnippetKey& rhs) const {
+    return body == rhs.body && inputShapes == rhs.inputShapes && outputShapes == rhs.outputShapes;
+}
+} // namespace
+
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(op, eng, cache) {
     host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ?
         dnnl::impl::cpu::x64::avx512_core : dnnl::impl::cpu::x64::avx2;
 
-    // Create a deep local copy of the input snippet to perform canonicalization & code generation
-    // Todo: Probably better to implement a proper copy constructor
     if (const auto tmp_snippet =  ov::as_type_ptr<ngraph::snippets::op::Subgraph>(op)) {
-        ngraph::OutputVector subgraph_node_inputs;
-        for (const auto &input : tmp_snippet->input_values()) {
-            auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
-            subgraph_node_inputs.push_back(new_input);
-        }
-        auto new_body = ov::clone_model(*tmp_snippet->get_body().get());
-        snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-        ngraph::copy_runtime_info(tmp_snippet, snippet);
-        snippet->set_friendly_name(tmp_snippet->get_friendly_name());
-        snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        snippet = copySnippet(tmp_snippet, host_isa);
+        originalBody = tmp_snippet->get_body();
     } else {
         IE_THROW(NotImplemented) << "Node is not an instance of snippets::op::Subgraph";
     }
+    initShapeInfer();
+}
+
+std::shared_ptr<ngraph::snippets::op::Subgraph> Snippet::copySnippet(
+        const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph, dnnl::impl::cpu::x64::cpu_isa_t isa) {
+    // Create a deep local copy of the input snippet to perform canonicalization & code generation
+    // Todo: Probably better to implement a proper copy constructor
+    ngraph::OutputVector subgraph_node_inputs;
+    for (const auto &input : subgraph->input_values()) {
+        auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
+        subgraph_node_inputs.push_back(new_input);
+    }
+    auto new_body = ov::clone_model(*subgraph->get_body().get());
+    auto result = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(subgraph, result);
+    result->set_friendly_name(subgraph->get_friendly_name());
+    result->set_generator(std::make_shared<CPUGenerator>(isa));
+    return result;
+}
+
+void Snippet::initShapeInfer() {
+    const auto& body = snippet->get_body();
+    std::unordered_map<const ov::Node*, size_t> valueIds;
+    const auto& params = body->get_parameters();
+    for (size_t i = 0; i < params.size(); i++)
+        valueIds[params[i].get()] = i;
+
+    std::vector<std::shared_ptr<ov::Node>> ops;
+    for (const auto& op : body->get_ordered_ops()) {
+        if (ov::is_type<ngraph::opset1::Parameter>(op) || ov::is_type<ngraph::opset1::Result>(op))
+            continue;
+        if (op->get_output_size() != 1)
+            IE_THROW() << "Subgraph node with name `" << getName() << "` contains multi-output operation " << op->get_friendly_name();
+        if (ov::is_type<ngraph::opset1::Constant>(op)) {
+            valueIds[op.get()] = params.size() + shapeInferConstants.size();
+            shapeInferConstants.push_back(op->get_output_shape(0));
+        } else {
+            ops.push_back(op);
+        }
+    }
+    const size_t firstOpId = params.size() + shapeInferConstants.size();
+    for (const auto& op : ops) {
+        ShapeInferOp shapeInferOp;
+        for (const auto& input : op->input_values())
+            shapeInferOp.inputs.push_back(valueIds.at(input.get_node()));
+        shapeInferOp.firstInputShape = ov::is_type<ngraph::opset1::PRelu>(op) || ov::is_type<ngraph::opset6::MVN>(op);
+        valueIds[op.get()] = firstOpId + shapeInferOps.size();
+        shapeInferOps.push_back(std::move(shapeInferOp));
+    }
+    for (const auto& result : body->get_results())
+        shapeInferResults.push_back(valueIds.at(result->get_input_node_ptr(0)));
+}
+
+std::vector<VectorDims> Snippet::shapeInfer() const {
+    auto broadcast = [this](VectorDims& dst, const VectorDims& src) {
+        if (src.size() > dst.size())
+            dst.insert(dst.begin(), src.size() - dst.size(), 1);
+        const size_t offset = dst.size() - src.size();
+        for (size_t i = 0; i < src.size(); i++) {
+            auto& d = dst[offset + i];
+            if (d == 1) {
+                d = src[i];
+            } else if (src[i] != 1 && src[i] != d) {
+                IE_THROW() << "Subgraph node with name `" << getName() << "` got non-broadcastable input shapes";
+            }
+        }
+    };
+
+    std::vector<VectorDims> values;
+    values.reserve(getParentEdges().size() + shapeInferConstants.size() + shapeInferOps.size());
+    for (size_t i = 0; i < getParentEdges().size(); i++)
+        values.push_back(getParentEdgesAtPort(i)[0]->getMemory().getStaticDims());
+    values.insert(values.end(), shapeInferConstants.begin(), shapeInferConstants.end());
+    for (const auto& op : shapeInferOps) {
+        VectorDims dims = values[op.inputs[0]];
+        if (!op.firstInputShape) {
+            for (size_t i = 1; i < op.inputs.size(); i++)
+                broadcast(dims, values[op.inputs[i]]);
+        }
+        values.push_back(std::move(dims));
+    }
+
+    std::vector<VectorDims> result;
+    result.reserve(shapeInferResults.size());
+    for (const auto id : shapeInferResults)
+        result.push_back(values[id]);
+    return result;
 }
 
 void Snippet::initSupportedPrimitiveDescriptors() {
@@ -72,11 +187,13 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual;
+    // Reductions are performed along the innermost dimension of the original shape, so only planar layout fits them
+    const bool isPlanarOnly = snippet->has_domain_sensitive_ops();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 4, 5) && dimRanksAreEqual && !isPlanarOnly;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !isPlanarOnly;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -180,21 +297,69 @@ void Snippet::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
 }
 
-void Snippet::createPrimitive() {
-    // schedule definition part
-    // it defines offsets, strides and sizes for snippet kernel scheduling
-    define_schedule();
+void Snippet::prepareParams() {
+    auto edgeToBlockedShape = [](const EdgePtr& edge) {
+        const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
+        ngraph::Shape shape(blockedDesc->getBlockDims());
+        ngraph::AxisVector blocking(blockedDesc->getOrder());
+        ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
+        return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
+    };
 
-    // code generation part
-    // it might be worth to generate explicitly for scheduler work amount for now,
-    // but in future some interface should be defined in order to communicate schedule for a kernel
-    // or generate schedule for a kernel.
-    // Here kernel is generated for most warying dimension by default.
-    generate();
+    SnippetKey key;
+    key.body = originalBody;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        key.inputShapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
+    for (size_t i = 0; i < outputShapes.size(); i++)
+        key.outputShapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
+
+    auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetJitExecutor> {
+        return std::make_shared<SnippetJitExecutor>(copySnippet(snippet, host_isa), key.inputShapes, key.outputShapes);
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    execPtr = result.first;
+
+    const size_t inputNum = getParentEdges().size();
+    start_offset_in.resize(inputNum);
+    srcMemPtrs.resize(inputNum);
+    for (size_t i = 0; i < inputNum; i++) {
+        const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
+        const auto desc = memPtr->GetDescWithType<BlockedMemoryDesc>();
+        srcMemPtrs[i] = memPtr;
+        start_offset_in[i] = desc->getOffsetPadding() * desc->getPrecision().size();
+    }
+
+    const size_t outputNum = outputShapes.size();
+    start_offset_out.resize(outputNum);
+    dstMemPtrs.resize(outputNum);
+    for (size_t i = 0; i < outputNum; i++) {
+        const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
+        const auto desc = memPtr->GetDescWithType<BlockedMemoryDesc>();
+        dstMemPtrs[i] = memPtr;
+        start_offset_out[i] = desc->getOffsetPadding() * desc->getPrecision().size();
+    }
+}
+
+Node::PreparedStatePtr Snippet::getPreparedState() const {
+    auto state = std::make_shared<SnippetPreparedState>();
+    state->execPtr = execPtr;
+    state->start_offset_in = start_offset_in;
+    state->start_offset_out = start_offset_out;
+    return state;
+}
+
+void Snippet::restorePreparedState(const PreparedStatePtr& state) {
+    // the memory pointers are the same for all the shapes, they are set by the first prepareParams() call
+    const auto& snippetState = static_cast<const SnippetPreparedState&>(*state);
+    execPtr = snippetState.execPtr;
+    start_offset_in = snippetState.start_offset_in;
+    start_offset_out = snippetState.start_offset_out;
 }
 
 void Snippet::execute(dnnl::stream strm) {
-    if (schedule.ptr == nullptr || !canUseOptimizedImpl) {
+    if (!execPtr || !execPtr->canUseOptimizedImpl()) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
     jit_snippets_call_args call_args;
@@ -204,11 +369,11 @@ void Snippet::execute(dnnl::stream strm) {
     for (size_t i = 0; i < dstMemPtrs.size(); i++)
         call_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(dstMemPtrs[i]->GetData()) + start_offset_out[i];
 
-    if (tensorRank == rank6D) {
-        schedule_6d(call_args);
-    } else {
-        schedule_nt(call_args);
-    }
+    execPtr->exec(call_args);
+}
+
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
 }
 
 bool Snippet::created() const {
@@ -228,6 +393,11 @@ InferenceEngine::Precision Snippet::getRuntimePrecision() const {
 }
 
 bool Snippet::canBeInPlace() const {
+    // the input may be broadcasted at runtime
+    if (isDynamicNode()) {
+        return false;
+    }
+
     if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Type::Input) {
         return false;
     }
@@ -277,14 +447,32 @@ static auto collapseLastDims(std::vector<size_t>& dims, size_t dimsToCollapse) -
     }
 }
 
-void Snippet::define_schedule() {
-    auto edgeToBlockedShape = [](const EdgePtr& edge) {
-        const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
-        ngraph::Shape shape(blockedDesc->getBlockDims());
-        ngraph::AxisVector blocking(blockedDesc->getOrder());
-        ngraph::element::Type precision = InferenceEngine::details::convertPrecision(blockedDesc->getPrecision());
-        return ngraph::snippets::op::Subgraph::BlockedShape{shape, blocking, precision};
-    };
+Snippet::SnippetJitExecutor::SnippetJitExecutor(const std::shared_ptr<ngraph::snippets::op::Subgraph>& snippet,
+                                                const ngraph::snippets::op::Subgraph::BlockedShapeVector& inputShapes,
+                                                const ngraph::snippets::op::Subgraph::BlockedShapeVector& outputShapes)
+        : snippet(snippet) {
+    // schedule definition part
+    // it defines offsets, strides and sizes for snippet kernel scheduling
+    define_schedule(inputShapes, outputShapes);
+
+    // code generation part
+    // it might be worth to generate explicitly for scheduler work amount for now,
+    // but in future some interface should be defined in order to communicate schedule for a kernel
+    // or generate schedule for a kernel.
+    // Here kernel is generated for most warying dimension by default.
+    generate();
+}
+
+void Snippet::SnippetJitExecutor::exec(const jit_snippets_call_args& call_args) const {
+    if (tensorRank == rank6D) {
+        schedule_6d(call_args);
+    } else {
+        schedule_nt(call_args);
+    }
+}
+
+void Snippet::SnippetJitExecutor::define_schedule(const ngraph::snippets::op::Subgraph::BlockedShapeVector& input_blocked_shapes,
+                                                  const ngraph::snippets::op::Subgraph::BlockedShapeVector& output_blocked_shapes) {
     auto prependWithOnes = [this](const std::vector<size_t>& dims) {
         if (tensorRank <= dims.size())
             return dims;
@@ -292,13 +480,10 @@ void Snippet::define_schedule() {
         std::copy(dims.begin(), dims.end(), &result[tensorRank - dims.size()]);
         return result;
     };
-    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
-    for (size_t i = 0; i < inputShapes.size(); i++)
-        input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
-
-    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
-    for (size_t i = 0; i < outputShapes.size(); i++)
-        output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
+    for (const auto& shape : input_blocked_shapes)
+        dataSize_in.push_back(std::get<2>(shape).size());
+    for (const auto& shape : output_blocked_shapes)
+        dataSize_out.push_back(std::get<2>(shape).size());
 
     exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
 
@@ -316,50 +501,33 @@ void Snippet::define_schedule() {
         dims_out.push_back(prependWithOnes(body->get_output_shape(i)));
     }
 
-    const auto config = getSelectedPrimitiveDescriptor()->getConfig();
-    auto initOffsets = [this, config]() {
+    auto initOffsets = [this]() {
         // find max rank input among all outputs
-        const size_t inputNum = getParentEdges().size();
+        const size_t inputNum = dims_in.size();
         offsets_in.resize(inputNum);
         for (size_t i = 0; i < inputNum; i++) {
             offsets_in[i].resize(tensorRank, 1);
             offset_calculation(offsets_in[i], dims_in[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_in[i][j] *= config.inConfs[i].getMemDesc()->getPrecision().size();
+                offsets_in[i][j] *= dataSize_in[i];
             }
         }
 
-        start_offset_in.resize(inputNum);
-        srcMemPtrs.resize(inputNum);
-        for (size_t i = 0; i < inputNum; i++) {
-            const auto memPtr = getParentEdgeAt(i)->getMemoryPtr();
-            srcMemPtrs[i] = memPtr;
-            start_offset_in[i] =  memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() *
-                    config.inConfs[i].getMemDesc()->getPrecision().size();
-        }
-
-        const size_t outputNum = config.outConfs.size();
+        const size_t outputNum = dims_out.size();
         offsets_out.resize(outputNum);
         for (size_t i = 0; i < outputNum; i++) {
             offsets_out[i].resize(tensorRank, 1);
             offset_calculation(offsets_out[i], dims_out[i], exec_domain);
             for (size_t j = 0; j < tensorRank; j++) {
-                offsets_out[i][j] *= config.outConfs[i].getMemDesc()->getPrecision().size();
+                offsets_out[i][j] *= dataSize_out[i];
             }
         }
-
-        start_offset_out.resize(outputNum);
-        dstMemPtrs.resize(outputNum);
-        for (size_t i = 0; i < outputNum; i++) {
-            const auto memPtr = getChildEdgeAt(i)->getMemoryPtr();
-            dstMemPtrs[i] = memPtr;
-            start_offset_out[i] = memPtr->GetDescWithType<BlockedMemoryDesc>()->getOffsetPadding() *
-                    config.outConfs[i].getMemDesc()->getPrecision().size();
-        }
     };
 
-    auto find_dims_to_collapse = [this, config]() -> int {
+    auto find_dims_to_collapse = [this]() -> int {
         int collapsedDims = 0;
+        // the innermost dimension is a reduction domain, so it can't be merged with the outer ones
+        const bool hasDomainSensitiveOps = snippet->has_domain_sensitive_ops();
         size_t minimalConcurrency = parallel_get_max_threads();
         size_t minimalJitWorkAmount = 256;
         size_t currentJitWorkAmount = exec_domain.back();
@@ -367,8 +535,8 @@ void Snippet::define_schedule() {
             if (static_cast<int>(exec_domain.size()) - collapsedDims - 2 < 0)
                 break;
 
-            bool canCollapse = true;
-            for (size_t i = 0; i < dims_in.size(); i++) {
+            bool canCollapse = !hasDomainSensitiveOps;
+            for (size_t i = 0; canCollapse && i < dims_in.size(); i++) {
                 if ((dims_in[i][dims_in[i].size() - 2] != 1 && dims_in[i][dims_in[i].size() - 1] == 1) ||
                     (dims_in[i][dims_in[i].size() - 2] == 1 && dims_in[i][dims_in[i].size() - 1] != 1)) {
                     canCollapse = false;
@@ -404,7 +572,7 @@ void Snippet::define_schedule() {
         return collapsedDims;
     };
 
-    auto initSchedulingInfo = [this, config]() -> void {
+    auto initSchedulingInfo = [this]() -> void {
         // initialize scheduling information
         sch_offsets_in.resize(offsets_in.size(), 0);
         sch_offsets_out.resize(offsets_out.size(), 0);
@@ -420,7 +588,7 @@ void Snippet::define_schedule() {
             const int64_t vector_size = snippet->get_generator()->get_target_machine()->get_lanes();
             for (size_t i = 0; i < offsets_in.size(); i++) {
                 const int64_t offset = offsets_in[i][tensorRank - 2];
-                const int64_t data_size = config.inConfs[i].getMemDesc()->getPrecision().size();
+                const int64_t data_size = dataSize_in[i];
                 if (offset == data_size || offset == vector_size * data_size) {
                     sch_offsets_in[i] = offset;
                 } else if ((offset > data_size) || (offset == 0 && dims_in[i].back() != 1 && dims_in[i].back() != vector_size)) {
@@ -436,7 +604,7 @@ void Snippet::define_schedule() {
 
             for (size_t i = 0; i < offsets_out.size(); i++) {
                 const int64_t offset = offsets_out[i][tensorRank - 2];
-                const size_t data_size = config.outConfs[i].getMemDesc()->getPrecision().size();
+                const size_t data_size = dataSize_out[i];
                 if (offset == data_size || offset == vector_size * data_size) {
                     sch_offsets_out[i] = offset;
                 } else if ((offset > data_size) || (offset == 0 && dims_out[i].back() != 1 && dims_out[i].back() != vector_size)) {
@@ -465,7 +633,7 @@ void Snippet::define_schedule() {
     initSchedulingInfo();
 }
 
-void Snippet::generate() {
+void Snippet::SnippetJitExecutor::generate() {
     jit_snippets_compile_args jcp;
     jcp.output_dims = exec_domain;
     std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
@@ -473,16 +641,16 @@ void Snippet::generate() {
     std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
     size_t harness_num_dims = jcp.output_dims.size() - 1;
     if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
-        canUseOptimizedImpl = false;
+        optimizedImpl = false;
         harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
     }
-    for (size_t i = 0; i < inputShapes.size(); i++) {
+    for (size_t i = 0; i < offsets_in.size(); i++) {
         auto b = offsets_in[i].begin();
         std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
     }
-    for (size_t i = 0; i < outputShapes.size(); i++) {
+    for (size_t i = 0; i < offsets_out.size(); i++) {
         auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
+        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(offsets_in.size() + i) * harness_num_dims]);
     }
 
     ov::pass::Manager optManager;
@@ -508,7 +676,7 @@ void Snippet::generate() {
     schedule = snippet->generate(optManager, reinterpret_cast<void*>(&jcp));
 }
 
-void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
+void Snippet::SnippetJitExecutor::schedule_6d(const jit_snippets_call_args& call_args) const {
     const auto& dom = exec_domain;
     // < N, C, H, W > < 1, 1, N, C*H*W>
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
@@ -518,7 +686,7 @@ void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
         });
 }
 
-void Snippet::schedule_nt(const jit_snippets_call_args& call_args) const {
+void Snippet::SnippetJitExecutor::schedule_nt(const jit_snippets_call_args& call_args) const {
     const auto& work_size = exec_domain;
     parallel_nt(0, [&](const int ithr, const int nthr) {
         size_t start = 0, end = 0;
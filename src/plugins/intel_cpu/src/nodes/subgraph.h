@@ -32,64 +32,118 @@ public:
     void selectOptimalPrimitiveDescriptor() override;
     InferenceEngine::Precision getRuntimePrecision() const override;
 
-    // Here we convert to canonical for & jit everything
-    void createPrimitive() override;
-
     bool canBeInPlace() const override;
     bool created() const override;
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+protected:
+    // Here we convert to canonical for & jit everything
+    void prepareParams() override;
+    std::vector<VectorDims> shapeInfer() const override;
+    PreparedStatePtr getPreparedState() const override;
+    void restorePreparedState(const PreparedStatePtr& state) override;
 
 private:
     static const size_t rank6D {6};
 
     typedef void (*kernel)(const void *, const void *);
 
-    void define_schedule();
+    // Generated snippet with information about how to schedule it. It depends only on the subgraph body and
+    // the blocked input/output shapes, so the kernels are shared via the runtime cache
+    class SnippetJitExecutor {
+    public:
+        SnippetJitExecutor(const std::shared_ptr<ngraph::snippets::op::Subgraph>& snippet,
+                           const ngraph::snippets::op::Subgraph::BlockedShapeVector& inputShapes,
+                           const ngraph::snippets::op::Subgraph::BlockedShapeVector& outputShapes);
+
+        void exec(const jit_snippets_call_args& call_args) const;
+
+        bool canUseOptimizedImpl() const { return optimizedImpl; }
+
+    private:
+        void define_schedule(const ngraph::snippets::op::Subgraph::BlockedShapeVector& inputShapes,
+                             const ngraph::snippets::op::Subgraph::BlockedShapeVector& outputShapes);
+
+        void generate();
+
+        // Evaluates generated snippet using parallel backend
+        void schedule_6d(const jit_snippets_call_args& const_args) const;
+        void schedule_nt(const jit_snippets_call_args& const_args) const;
+
+        // Local copy of subgraph node for canonization & code generation, owns the generated code
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
-    void generate();
+        // Holds generated snippet with information about how to schedule it
+        ngraph::snippets::Schedule schedule;
 
-    // Evaluates generated snippet using parallel backend
-    void schedule_6d(const jit_snippets_call_args& const_args) const;
-    void schedule_nt(const jit_snippets_call_args& const_args) const;
+        // Holds index of output used as in execution domain
+        // it should be compatible with a schedule's work size
+        std::vector<size_t> exec_domain = {};
 
-    // Local copy of subgraph node for canonization & code generation
+        /// scheduling info
+        size_t batchDimIdx = 0;
+        size_t tensorRank = 0;
+        size_t tileRank = 1;
+        size_t fullWorkAmount = 0;
+        size_t schedulerWorkAmount = 0;
+        const size_t maxTileRank = 2;
+
+        std::vector<size_t> dataSize_in = {};
+        std::vector<size_t> dataSize_out = {};
+
+        std::vector<std::vector<size_t>> dims_in = {};
+        std::vector<std::vector<size_t>> offsets_in = {};
+
+        std::vector<std::vector<size_t>> dims_out = {};
+        std::vector<std::vector<size_t>> offsets_out = {};
+
+        std::vector<int64_t> sch_dims = {};
+        std::vector<int64_t> sch_offsets_in = {};
+        std::vector<int64_t> sch_offsets_out = {};
+        bool optimizedImpl = true;
+    };
+
+    static std::shared_ptr<ngraph::snippets::op::Subgraph> copySnippet(
+            const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph, dnnl::impl::cpu::x64::cpu_isa_t isa);
+
+    void initShapeInfer();
+
+    // Local copy of subgraph node, the kernels are generated on its copies
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
-    // Holds generated snippet with information about how to schedule it
-    ngraph::snippets::Schedule schedule;
+    // Body of the original subgraph node, identifies the kernel in the runtime cache
+    std::shared_ptr<ov::Model> originalBody;
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
 
-    // Holds index of output used as in execution domain
-    // it should be compatible with a schedule's work size
-    std::vector<size_t> exec_domain = {};
-
-    /// scheduling info
-    size_t batchDimIdx = 0;
-    size_t tensorRank = 0;
-    size_t tileRank = 1;
-    size_t fullWorkAmount = 0;
-    size_t schedulerWorkAmount = 0;
-    const size_t maxTileRank = 2;
+    std::shared_ptr<SnippetJitExecutor> execPtr = nullptr;
 
     std::vector<MemoryPtr> srcMemPtrs = {};
     std::vector<MemoryPtr> dstMemPtrs = {};
 
-    std::vector<std::vector<size_t>> dims_in = {};
-    std::vector<std::vector<size_t>> offsets_in = {};
     std::vector<ptrdiff_t> start_offset_in = {};
     std::vector<ptrdiff_t> start_offset_out = {};
 
-    std::vector<std::vector<size_t>> dims_out = {};
-    std::vector<std::vector<size_t>> offsets_out = {};
-
-    std::vector<int64_t> sch_dims = {};
-    std::vector<int64_t> sch_offsets_in = {};
-    std::vector<int64_t> sch_offsets_out = {};
-    bool canUseOptimizedImpl = true;
+    struct SnippetPreparedState : public PreparedState {
+        std::shared_ptr<SnippetJitExecutor> execPtr;
+        std::vector<ptrdiff_t> start_offset_in;
+        std::vector<ptrdiff_t> start_offset_out;
+    };
+
+    // Body ops are elementwise, so the output shapes are inferred by numpy broadcasting along the body
+    // instead of the body revalidation. Values are numbered: inputs, then constants, then ops outputs
+    struct ShapeInferOp {
+        std::vector<size_t> inputs;
+        // the output has the shape of the first input (e.g. PRelu with per-channel slope)
+        bool firstInputShape;
+    };
+    std::vector<VectorDims> shapeInferConstants = {};
+    std::vector<ShapeInferOp> shapeInferOps = {};
+    std::vector<size_t> shapeInferResults = {};
 };
 
 }   // namespace node
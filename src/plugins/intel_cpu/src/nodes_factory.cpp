@@ -89,6 +89,7 @@
 #include "nodes/priorbox_clustered.h"
 #include "nodes/eye.h"
 #include "nodes/mha.h"
+#include "nodes/preprocess.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -190,6 +191,7 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(PriorBoxClustered, Type::PriorBoxClustered);
     INTEL_CPU_NODE(Eye, Type::Eye);
     INTEL_CPU_NODE(MHA, Type::MHA);
+    INTEL_CPU_NODE(Preprocess, Type::Preprocess);
 }
 
 #undef INTEL_CPU_NODE
@@ -88,6 +88,7 @@
 #include <transformations/op_conversions/softsign_decomposition.hpp>
 #include "transformations/op_conversions/eye_decomposition.hpp"
 #include "ngraph_transformations/mha_fusion.hpp"
+#include "ngraph_transformations/preprocess_fusion.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
@@ -96,6 +97,7 @@
 #include <ngraph/opsets/opset6.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <openvino/pass/profiler.hpp>
 #include <ngraph/graph_util.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
@@ -313,7 +315,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     manager.register_pass<ngraph::pass::ConvertMulticlassNmsToMulticlassNmsIE>();
     manager.register_pass<ngraph::pass::ConvertMatrixNmsToMatrixNmsIE>();
     manager.register_pass<ngraph::pass::TransposeMatMul>();
-    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConstantFolding>(true);
 
     if (useLpt) {
         CPU_LPT_SCOPE(LowPrecisionTransformations_Part2);
@@ -614,15 +616,22 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
 
         // Implementation calls AMX BF16 brgemm only for tensors with K and N aligned on 2, otherwise fallbacks on vector impl
         // Vector madd BF16 instruction on SPR has reduced performance on HW level, which results in overall perf degradation
+        // Alignment of dynamic sequence length is unknown, so such MHA is fused and the implementation selection is made in runtime
         size_t bf16Factor = 2;
+        auto isNotAligned = [&](const ov::Dimension& dim) {
+            return dim.is_static() && dim.get_length() % bf16Factor != 0;
+        };
         if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_bf16_amx_bf16) &&
                 (n->get_input_element_type(0) == element::bf16 || (n->get_input_element_type(0) == element::f32 && _enableBF16)) &&
-                (n->get_input_shape(0)[3] % bf16Factor != 0 || n->get_input_shape(1)[1] % bf16Factor != 0 || n->get_input_shape(3)[3] % bf16Factor != 0)) {
+                (isNotAligned(n->get_input_partial_shape(0)[3]) || isNotAligned(n->get_input_partial_shape(1)[1]) ||
+                 isNotAligned(n->get_input_partial_shape(3)[3]))) {
             return true;
         }
 
         return false;
     });
+    // The preprocessing chains at the inputs are fused before snippets tokenization takes their eltwise operations
+    postLPTPassManager.register_pass<PreprocessFusion>();
     postLPTPassManager.run_passes(nGraphFunc);
 
     if (!useLpt && _enableSnippets && dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
@@ -640,7 +649,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -796,6 +805,15 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     const bool enableDynamicBatch = (dynamicBatchProp != config.end() && dynamicBatchProp->second == PluginConfigParams::YES)
             || engConfig.enableDynamicBatch;
     const bool enableSnippets = !(enableModelCache || enableDynamicBatch || enableBF16);
+    const auto& perfCountProp = config.find(InferenceEngine::PluginConfigParams::KEY_PERF_COUNT);
+    const bool enablePassProfiling = (perfCountProp != config.end() && perfCountProp->second == PluginConfigParams::YES)
+            || (perfCountProp == config.end() && engConfig.collectPerfCounters);
+    // the passes run by the plugin are profiled together with the nodes, see ov::intel_cpu::transformations_profile
+    std::shared_ptr<ov::pass::PassProfiler> passProfiler;
+    if (enablePassProfiling)
+        passProfiler = std::make_shared<ov::pass::PassProfiler>();
+    ov::pass::PassProfiler::Scope passProfilerScope(passProfiler);
+
     auto nGraphFunc = clonedNetwork.getFunction();
     TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, isLegacyAPI());
 
@@ -834,7 +852,22 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, getRuntimeCache(conf),
+                                         shared_from_this(), nullptr, passProfiler);
+}
+
+MultiCachePtr Engine::getRuntimeCache(const Config& conf) {
+    if (conf.rtCachePerNetwork)
+        return std::make_shared<MultiCache>(conf.rtCacheCapacity);
+
+    std::lock_guard<std::mutex> lock(rtCacheMutex);
+    auto& weakCache = rtParamsCaches[conf.rtCacheCapacity];
+    auto cache = weakCache.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(conf.rtCacheCapacity);
+        weakCache = cache;
+    }
+    return cache;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -1140,6 +1173,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
+    auto compiledConstants = std::make_shared<CompiledConstants>();
+    deserializer >> *compiledConstants;
 
     Config conf = engConfig;
     conf.readProperties(config);
@@ -1148,7 +1183,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, getRuntimeCache(conf),
+                                                     shared_from_this(), compiledConstants);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -9,6 +9,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <memory>
 #include <functional>
@@ -50,6 +51,11 @@ private:
 
     void ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const;
 
+    /* Returns the runtime parameters cache shared by all the alive networks with the same cache capacity,
+       so the kernels compiled for one network are reused by the others.
+       A network configured with CPU_RUNTIME_CACHE_PER_NETWORK gets its own cache */
+    MultiCachePtr getRuntimeCache(const Config& conf);
+
     Config engConfig;
     ExtensionManager::Ptr extensionManager = std::make_shared<ExtensionManager>();
     /* Explicily configured streams have higher priority even than performance hints.
@@ -58,6 +64,9 @@ private:
     const std::string deviceFullName;
 
     std::shared_ptr<void> specialSetup;
+
+    std::mutex rtCacheMutex;
+    std::map<size_t, std::weak_ptr<MultiCache>> rtParamsCaches;
 };
 
 }   // namespace intel_cpu
@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "serialize.h"
+#include "graph.h"
+#include "cpu_memory.h"
 
 #include <openvino/pass/serialize.hpp>
 
+#include <algorithm>
+
 #include <pugixml.hpp>
 
 using namespace InferenceEngine;
@@ -65,6 +69,28 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    /*
+        Compiled constants section format:
+        [ magic | version | count ]
+        count x [ key size | key | dnnl_memory_desc_t | data offset | data size ]
+        [ data region size | data region ]
+        The data of every constant is aligned within the data region. The region is read at once into an aligned
+        buffer and the constant edges point into it, so it may be mapped from the file instead of being read.
+    */
+    const char compiledConstantsMagic[8] = {'C', 'P', 'U', 'C', 'O', 'N', 'S', 'T'};
+    const uint32_t compiledConstantsVersion = 3;
+    const uint64_t compiledConstantsAlignment = 64;
+
+    template<typename T>
+    void write(std::ostream & stream, const T & value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof value);
+    }
+
+    template<typename T>
+    bool read(std::istream & stream, T & value) {
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof value));
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -125,6 +151,51 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
+void CNNNetworkSerializer::operator << (Graph & graph) {
+    std::vector<EdgePtr> constants;
+    for (const auto& edge : graph.GetEdges()) {
+        // constants coming from the model are stored as a part of the network,
+        // edges sharing the memory of another one are restored through their owner
+        if (edge->getStatus() == Edge::Status::Validated && edge->hasOwnMemory() &&
+            edge->getParent()->isConstant() && edge->getParent()->getType() != Type::Input &&
+            edge->getMemory().isAllocated())
+            constants.push_back(edge);
+    }
+
+    auto alignUp = [](uint64_t size) {
+        return (size + compiledConstantsAlignment - 1) / compiledConstantsAlignment * compiledConstantsAlignment;
+    };
+
+    _ostream.write(compiledConstantsMagic, sizeof compiledConstantsMagic);
+    write(_ostream, compiledConstantsVersion);
+    write(_ostream, static_cast<uint64_t>(constants.size()));
+    uint64_t regionSize = 0;
+    for (const auto& edge : constants) {
+        const auto key = edge->name();
+        const auto& memory = edge->getMemory();
+        const auto desc = MemoryDescUtils::convertToDnnlMemoryDesc(memory.getDescPtr())->getDnnlDesc();
+        const auto dataSize = static_cast<uint64_t>(memory.GetSize());
+
+        write(_ostream, static_cast<uint64_t>(key.size()));
+        _ostream.write(key.data(), key.size());
+        write(_ostream, desc.data);
+        write(_ostream, regionSize);
+        write(_ostream, dataSize);
+        regionSize = alignUp(regionSize + dataSize);
+    }
+
+    write(_ostream, regionSize);
+    const std::vector<char> padding(compiledConstantsAlignment, 0);
+    uint64_t offset = 0;
+    for (const auto& edge : constants) {
+        const auto& memory = edge->getMemory();
+        const auto dataSize = static_cast<uint64_t>(memory.GetSize());
+        _ostream.write(static_cast<const char*>(memory.GetData()), dataSize);
+        _ostream.write(padding.data(), alignUp(offset + dataSize) - offset - dataSize);
+        offset = alignUp(offset + dataSize);
+    }
+}
+
 CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
     : _istream(istream)
     , _cnn_network_builder(fn) {
@@ -162,6 +233,7 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     _istream.seekg(hdr.model_offset);
     xmlString.resize(hdr.model_size);
     _istream.read(const_cast<char*>(xmlString.c_str()), hdr.model_size);
+    _networkEnd = _istream.tellg();
 
     network = _cnn_network_builder(xmlString, std::move(dataBlob));
 
@@ -174,5 +246,61 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+void CNNNetworkDeserializer::operator >> (CompiledConstants & constants) {
+    constants.clear();
+    _istream.seekg(_networkEnd);
+
+    // blobs exported without compiled constants are still valid
+    char magic[sizeof compiledConstantsMagic] = {};
+    uint32_t version = 0;
+    uint64_t count = 0;
+    if (!_istream.read(magic, sizeof magic) ||
+        !std::equal(std::begin(magic), std::end(magic), std::begin(compiledConstantsMagic)) ||
+        !read(_istream, version) || version != compiledConstantsVersion ||
+        !read(_istream, count)) {
+        // the stream may hold other blobs after the network, so leave the position untouched
+        _istream.clear();
+        _istream.seekg(_networkEnd);
+        return;
+    }
+
+    std::vector<std::pair<std::string, uint64_t>> offsets;
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t keySize = 0, offset = 0, dataSize = 0;
+        std::string key;
+        CompiledConstant constant;
+
+        if (!read(_istream, keySize))
+            IE_THROW(NetworkNotRead) << "The compiled constants section is corrupted.";
+        key.resize(keySize);
+        _istream.read(&key[0], keySize);
+        read(_istream, constant.desc.data);
+        read(_istream, offset);
+        if (!read(_istream, dataSize))
+            IE_THROW(NetworkNotRead) << "The compiled constants section is corrupted.";
+        constant.size = static_cast<size_t>(dataSize);
+
+        offsets.emplace_back(key, offset);
+        constants.emplace(std::move(key), std::move(constant));
+    }
+
+    uint64_t regionSize = 0;
+    if (!read(_istream, regionSize))
+        IE_THROW(NetworkNotRead) << "The compiled constants section is corrupted.";
+    // the only copy of the data, the constant edges of all the stream graphs point to it
+    auto region = std::make_shared<MemoryMngrWithReuse>();
+    region->resize(regionSize);
+    auto regionData = static_cast<const uint8_t*>(region->getRawPtr());
+    if (!_istream.read(static_cast<char*>(region->getRawPtr()), regionSize))
+        IE_THROW(NetworkNotRead) << "The compiled constants section is corrupted.";
+
+    for (const auto& it : offsets) {
+        auto& constant = constants.at(it.first);
+        if (it.second + constant.size > regionSize)
+            IE_THROW(NetworkNotRead) << "The compiled constants section is corrupted.";
+        constant.data = std::shared_ptr<const uint8_t>(region, regionData + it.second);
+    }
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -6,15 +6,43 @@
 
 #include <iostream>
 #include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <cpp/ie_cnn_network.h>
+#include <onednn/dnnl.h>
 
 namespace ov {
 namespace intel_cpu {
 
+class Graph;
+
+/**
+ * @brief Output of a constant subgraph of the compiled graph, i.e. weights already converted and reordered
+ * into the layout selected for the consuming node
+ */
+struct CompiledConstant {
+    dnnl::memory::desc desc;
+    /// points into the imported section, the edge memory is created on top of it, so the data is not copied
+    std::shared_ptr<const uint8_t> data;
+    size_t size = 0;
+};
+
+/**
+ * @brief Compiled constants keyed by the name of the graph edge holding them
+ */
+using CompiledConstants = std::unordered_map<std::string, CompiledConstant>;
+using CompiledConstantsCPtr = std::shared_ptr<const CompiledConstants>;
+
 class CNNNetworkSerializer {
 public:
     CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
     void operator << (const InferenceEngine::CNNNetwork & network);
+    /**
+     * @brief Appends the compiled constants of the graph, must follow the network
+     */
+    void operator << (Graph & graph);
 
 private:
     std::ostream & _ostream;
@@ -29,10 +57,15 @@ public:
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
+    /**
+     * @brief Reads the compiled constants following the network, if any
+     */
+    void operator >> (CompiledConstants & constants);
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::streamoff _networkEnd = 0;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -15,6 +15,7 @@
 
 #include "assign_shape_inference.hpp"
 #include "bucketize_shape_inference.hpp"
+#include "concat_shape_inference.hpp"
 #include "convolution_shape_inference.hpp"
 #include "ctc_greedy_decoder_seq_len_shape_inference.hpp"
 #include "ctc_greedy_decoder_shape_inference.hpp"
@@ -37,6 +38,7 @@
 #include "interpolate_shape_inference.hpp"
 #include "lstm_cell_shape_inference.hpp"
 #include "one_hot_shape_inference.hpp"
+#include "pooling_shape_inference.hpp"
 #include "read_value_shape_inference.hpp"
 #include "reduce_shape_inference.hpp"
 #include "reverse_sequence_shape_inference.hpp"
@@ -77,10 +79,16 @@
 #include "strided_slice_shape_inference.hpp"
 #include "tile_shape_inference.hpp"
 #include "topk_shape_inference.hpp"
+#include "transpose_shape_inference.hpp"
 #include "utils.hpp"
 #include "variadic_split_shape_inference.hpp"
 #include "matmul_shape_inference.hpp"
 #include "eye_shape_inference.hpp"
+#include "ngraph_transformations/op/fully_connected.hpp"
+#include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/power_static.hpp"
+#include "ngraph_transformations/op/preprocess.hpp"
+#include "ngraph_transformations/op/swish_cpu.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -90,7 +98,7 @@ void shape_inference(ov::Node* op,
                      std::vector<StaticShape>& output_shapes,
                      const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
     auto shapeInfer = make_shape_inference(op->shared_from_this());
-    output_shapes = shapeInfer->infer(input_shapes, constant_data);
+    shapeInfer->infer(input_shapes, output_shapes, constant_data);
 }
 
 class entryBase : public IShapeInfer {
@@ -119,6 +127,13 @@ public:
     }
 
 protected:
+    // the shapes are emptied but keep their storage, so the repeated inference doesn't allocate
+    static void reset_output_shapes(std::vector<StaticShape>& output_shapes, size_t size) {
+        output_shapes.resize(size);
+        for (auto& shape : output_shapes)
+            shape.clear();
+    }
+
     std::vector<int64_t> input_ranks;
     std::shared_ptr<ov::Node> node;
 };
@@ -128,13 +143,12 @@ class entryIO : public entryBase {
 public:
     using entryBase::entryBase;
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = static_cast<OP*>(node.get());
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         shape_infer(op, input_shapes, output_shapes);
-        return output_shapes;
     }
 };
 
@@ -143,13 +157,12 @@ class entryIOC : public entryBase {
 public:
     using entryBase::entryBase;
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = static_cast<OP*>(node.get());
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         shape_infer(op, input_shapes, output_shapes, constant_data);
-        return output_shapes;
     }
 };
 
@@ -157,13 +170,12 @@ class entryCopy : public entryBase {
 public:
     using entryBase::entryBase;
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = node.get();
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         copy_shape_infer(op, input_shapes, output_shapes);
-        return output_shapes;
     }
 };
 
@@ -171,13 +183,12 @@ class entryFirstPassthrough : public entryBase {
 public:
     using entryBase::entryBase;
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = node.get();
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         first_input_passthrough_infer(op, input_shapes, output_shapes);
-        return output_shapes;
     }
 };
 
@@ -185,13 +196,12 @@ class entryEltwise : public entryBase {
 public:
     using entryBase::entryBase;
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = node.get();
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         eltwise_shape_infer(op, input_shapes, output_shapes);
-        return output_shapes;
     }
 };
 
@@ -216,11 +226,10 @@ public:
 
     virtual void post_validate_and_infer_types(const std::shared_ptr<ov::Node>& local_op) {}
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = node.get();
-        std::vector<StaticShape> output_shapes;
 
         std::shared_ptr<ov::Node> local_op;
         if (!constant_data.empty()) {
@@ -269,12 +278,10 @@ public:
                 OPENVINO_ASSERT(false, errorMessage.str());
             }
 
-            output_shapes[i] = StaticShape(partial_shape.to_shape());
+            output_shapes[i] = partial_shape.to_shape();
         }
 
         post_validate_and_infer_types(local_op);
-
-        return output_shapes;
     }
 };
 
@@ -317,15 +324,14 @@ class entryInterpolate : public entryBase {
 public:
     using entryBase::entryBase;
 
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         std::vector<size_t> pads_begin, pads_end;
         auto op = static_cast<OP*>(node.get());
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         correct_pads_attr(op, pads_begin, pads_end, input_shapes);
         shape_infer(op, pads_begin, pads_end, input_shapes, output_shapes, constant_data);
-        return output_shapes;
     }
 };
 
@@ -339,16 +345,15 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         auto op = static_cast<OP*>(node.get());
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         bool status = resolve_auto_pad_for_shape(op, pads_begin, pads_end, input_shapes, 2, is_grouped ? 3 : 2);
         OPENVINO_ASSERT(status,
                         "Convolution shape inference doesn't have enough information to calculate static shapes");
         shape_infer(op, pads_begin, pads_end, input_shapes, output_shapes);
-        return output_shapes;
     }
 
 protected:
@@ -366,12 +371,12 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
-    std::vector<StaticShape> infer(
-        const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
         StaticShape output_shape_input;
         auto op = static_cast<OP*>(node.get());
-        std::vector<StaticShape> output_shapes(op->get_output_size());
+        reset_output_shapes(output_shapes, op->get_output_size());
         if (op->get_input_size() == 3)
             get_data_as_shape<StaticShape>(2, op, output_shape_input, constant_data);
         bool status = resolve_auto_pad_for_shape_back_prop(op,
@@ -385,7 +390,6 @@ public:
             status,
             "ConvolutionBackpropData shape inference doesn't have enough information to calculate static shapes");
         shape_infer(op, pads_begin, pads_end, output_shape_input, input_shapes, output_shapes);
-        return output_shapes;
     }
 
 protected:
@@ -393,6 +397,81 @@ protected:
     bool is_grouped;
 };
 
+template <typename OP>
+class entryPooling : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return pads_begin;
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return pads_end;
+    }
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<OP*>(node.get());
+        reset_output_shapes(output_shapes, op->get_output_size());
+        shape_infer(op, input_shapes, output_shapes, pads_begin, pads_end);
+    }
+
+protected:
+    ov::CoordinateDiff pads_begin, pads_end;
+};
+
+class entryFullyConnected : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<FullyConnectedNode*>(node.get());
+        reset_output_shapes(output_shapes, op->get_output_size());
+        NODE_VALIDATION_CHECK(op, input_shapes.size() >= 2 && output_shapes.size() == 1);
+
+        // Activations shape: [B1, ..., Bn, I1, ..., Im], weights shape: [O, I1, ..., Im], result shape: [B1, ..., Bn, O]
+        const auto& activations_shape = input_shapes[0];
+        const auto& weights_shape = input_shapes[1];
+        NODE_VALIDATION_CHECK(op,
+                              !weights_shape.empty() && activations_shape.size() >= weights_shape.size() - 1,
+                              "Incompatible activations shape ",
+                              activations_shape,
+                              " and weights shape ",
+                              weights_shape);
+        const size_t batch_rank = activations_shape.size() - (weights_shape.size() - 1);
+        const size_t output_rank = std::max<size_t>(op->get_output_rank().get_length(), batch_rank + 1);
+
+        auto& output_shape = output_shapes[0];
+        output_shape.assign(output_rank - batch_rank - 1, StaticDimension(1));
+        output_shape.insert(output_shape.end(), activations_shape.begin(), activations_shape.begin() + batch_rank);
+        output_shape.push_back(weights_shape[0]);
+    }
+};
+
+class entryPreprocess : public entryBase {
+public:
+    using entryBase::entryBase;
+
+    void infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
+        auto op = static_cast<PreprocessNode*>(node.get());
+        reset_output_shapes(output_shapes, op->get_output_size());
+        NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && input_shapes[0].size() == 4 && output_shapes.size() == 1);
+
+        // NHWC -> NCHW when the layout conversion is fused
+        const auto& input_shape = input_shapes[0];
+        auto& output_shape = output_shapes[0];
+        if (op->is_channels_last_input()) {
+            output_shape.assign({input_shape[0], input_shape[3], input_shape[1], input_shape[2]});
+        } else {
+            output_shape.assign(input_shape.begin(), input_shape.end());
+        }
+    }
+};
+
 template <typename OP>
 std::shared_ptr<entryIOC<OP>> make_shared_entryIOC(std::shared_ptr<OP> node) {
     return std::make_shared<entryIOC<OP>>(node);
@@ -420,10 +499,14 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
                ov::is_type<ov::opset1::Clamp>(op) || ov::is_type<ov::opset1::GRN>(op) || ov::is_type<ov::opset1::NormalizeL2>(op) ||
                ov::is_type<ov::opset1::LogicalNot>(op) || ov::is_type<ov::opset4::Mish>(op) || ov::is_type<ov::opset2::MVN>(op) ||
                ov::is_type<ov::opset1::Relu>(op) || ov::is_type<ov::opset1::Elu>(op) || ov::is_type<ov::opset1::Softmax>(op) ||
-               ov::is_type<ov::opset8::Softmax>(op) || ov::is_type<ov::opset5::Round>(op)) {
+               ov::is_type<ov::opset8::Softmax>(op) || ov::is_type<ov::opset5::Round>(op) ||
+               ov::is_type<ov::opset5::LogSoftmax>(op)) {
         return std::make_shared<entryCopy>(op);
     } else if (ov::is_type<ov::opset6::MVN>(op) || ov::is_type<ov::opset1::LRN>(op) ||
-               ov::is_type<ov::opset1::PRelu>(op) || ov::is_type<ov::opset4::Swish>(op)) {
+               ov::is_type<ov::opset1::PRelu>(op) || ov::is_type<ov::opset4::Swish>(op) ||
+               ov::is_type<ov::opset3::CumSum>(op) || ov::is_type<ov::opset3::ScatterUpdate>(op) ||
+               ov::is_type<ov::opset1::Selu>(op) || ov::is_type<SwishNode>(op) || ov::is_type<LeakyReluNode>(op) ||
+               ov::is_type<PowerStaticNode>(op)) {
         return std::make_shared<entryFirstPassthrough>(op);
     } else if (ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(op) ||
                ov::is_type<ov::op::util::BinaryElementwiseComparison>(op) ||
@@ -553,12 +636,20 @@ std::shared_ptr<IShapeInfer> make_shape_inference(const std::shared_ptr<ngraph::
         return make_shared_entryIOC(node);
     } else if (auto node = ov::as_type_ptr<ov::opset9::Eye>(op)) {
         return make_shared_entryIOC(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset1::Concat>(op)) {
+        return make_shared_entryIO(node);
+    } else if (auto node = ov::as_type_ptr<ov::opset1::Transpose>(op)) {
+        return make_shared_entryIOC(node);
+    } else if (ov::is_type<FullyConnectedNode>(op)) {
+        return std::make_shared<entryFullyConnected>(op);
+    } else if (ov::is_type<PreprocessNode>(op)) {
+        return std::make_shared<entryPreprocess>(op);
     } else if (auto node = ov::as_type_ptr<ov::op::v8::MaxPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v8::MaxPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v8::MaxPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::MaxPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v1::MaxPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v1::MaxPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::AvgPool>(op)) {
-        return std::make_shared<entryFallbackWithPadding<ov::op::v1::AvgPool>>(node);
+        return std::make_shared<entryPooling<ov::op::v1::AvgPool>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v1::DeformableConvolution>(op)) {
         return std::make_shared<entryFallbackWithPadding<ov::op::v1::DeformableConvolution>>(node);
     } else if (auto node = ov::as_type_ptr<ov::op::v8::DeformableConvolution>(op)) {
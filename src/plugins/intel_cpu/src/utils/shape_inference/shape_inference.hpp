@@ -20,9 +20,18 @@ void shape_inference(ov::Node* op,
 
 class IShapeInfer {
 public:
-    virtual std::vector<StaticShape> infer(
+    // output_shapes are resized to the number of outputs and overwritten, their storage is reused between calls
+    virtual void infer(const std::vector<StaticShape>& input_shapes,
+                       std::vector<StaticShape>& output_shapes,
+                       const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) = 0;
+
+    std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
-        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) = 0;
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
+        std::vector<StaticShape> output_shapes;
+        infer(input_shapes, output_shapes, constant_data);
+        return output_shapes;
+    }
 
     // infer may generate padding as by-product, these APIs is designed to retrieve them back
     virtual const ov::CoordinateDiff& get_pads_begin() = 0;
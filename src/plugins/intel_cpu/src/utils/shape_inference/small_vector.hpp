@@ -0,0 +1,351 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Vector with the inline storage for N elements, the heap is used only when it grows beyond N.
+ * Provides the std::vector API used by the shape inference. Restricted to the trivially copyable
+ * elements, so the elements are copied instead of being constructed/destroyed one by one
+ */
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value, "SmallVector supports trivially copyable types only");
+
+    template <typename It>
+    using RequireIterator = typename std::enable_if<
+        std::is_convertible<typename std::iterator_traits<It>::iterator_category, std::input_iterator_tag>::value>::type;
+
+public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SmallVector() = default;
+
+    explicit SmallVector(size_type count) {
+        resize(count);
+    }
+
+    SmallVector(size_type count, const T& value) {
+        assign(count, value);
+    }
+
+    template <typename InputIt, typename = RequireIterator<InputIt>>
+    SmallVector(InputIt first, InputIt last) {
+        assign(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+
+    SmallVector(const SmallVector& other) {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept {
+        steal(other);
+    }
+
+    ~SmallVector() {
+        release();
+    }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    void assign(size_type count, const T& value) {
+        const T copy = value;
+        clear();
+        resize(count, copy);
+    }
+
+    template <typename InputIt, typename = RequireIterator<InputIt>>
+    void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first)
+            push_back(*first);
+    }
+
+    void assign(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+
+    reference at(size_type pos) {
+        if (pos >= m_size)
+            throw std::out_of_range("SmallVector index is out of range");
+        return m_data[pos];
+    }
+    const_reference at(size_type pos) const {
+        if (pos >= m_size)
+            throw std::out_of_range("SmallVector index is out of range");
+        return m_data[pos];
+    }
+
+    reference operator[](size_type pos) {
+        return m_data[pos];
+    }
+    const_reference operator[](size_type pos) const {
+        return m_data[pos];
+    }
+
+    reference front() {
+        return m_data[0];
+    }
+    const_reference front() const {
+        return m_data[0];
+    }
+    reference back() {
+        return m_data[m_size - 1];
+    }
+    const_reference back() const {
+        return m_data[m_size - 1];
+    }
+
+    T* data() noexcept {
+        return m_data;
+    }
+    const T* data() const noexcept {
+        return m_data;
+    }
+
+    iterator begin() noexcept {
+        return m_data;
+    }
+    const_iterator begin() const noexcept {
+        return m_data;
+    }
+    const_iterator cbegin() const noexcept {
+        return m_data;
+    }
+    iterator end() noexcept {
+        return m_data + m_size;
+    }
+    const_iterator end() const noexcept {
+        return m_data + m_size;
+    }
+    const_iterator cend() const noexcept {
+        return m_data + m_size;
+    }
+    reverse_iterator rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator crbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    bool empty() const noexcept {
+        return m_size == 0;
+    }
+    size_type size() const noexcept {
+        return m_size;
+    }
+    size_type max_size() const noexcept {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+    size_type capacity() const noexcept {
+        return m_capacity;
+    }
+
+    void reserve(size_type new_cap) {
+        if (new_cap <= m_capacity)
+            return;
+        new_cap = std::max(new_cap, 2 * m_capacity);
+        T* new_data = new T[new_cap];
+        std::copy(begin(), end(), new_data);
+        if (!is_inline())
+            delete[] m_data;
+        m_data = new_data;
+        m_capacity = new_cap;
+    }
+
+    void shrink_to_fit() {}
+
+    void clear() noexcept {
+        m_size = 0;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return insert(pos, 1, value);
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        const auto idx = static_cast<size_type>(pos - cbegin());
+        // the value may refer to an element of this vector
+        const T copy = value;
+        make_gap(idx, count);
+        std::fill(m_data + idx, m_data + idx + count, copy);
+        return m_data + idx;
+    }
+
+    template <typename InputIt, typename = RequireIterator<InputIt>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        const auto idx = static_cast<size_type>(pos - cbegin());
+        // the range may refer to the elements of this vector, so it is copied before the gap is made
+        const SmallVector values(first, last);
+        make_gap(idx, values.size());
+        std::copy(values.begin(), values.end(), m_data + idx);
+        return m_data + idx;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        return insert(pos, T(std::forward<Args>(args)...));
+    }
+
+    iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const auto idx = static_cast<size_type>(first - cbegin());
+        const auto count = static_cast<size_type>(last - first);
+        std::copy(m_data + idx + count, end(), m_data + idx);
+        m_size -= count;
+        return m_data + idx;
+    }
+
+    void push_back(const T& value) {
+        const T copy = value;
+        reserve(m_size + 1);
+        m_data[m_size++] = copy;
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        push_back(T(std::forward<Args>(args)...));
+        return back();
+    }
+
+    void pop_back() {
+        --m_size;
+    }
+
+    void resize(size_type count) {
+        resize(count, T());
+    }
+
+    void resize(size_type count, const T& value) {
+        if (count > m_size) {
+            const T copy = value;
+            reserve(count);
+            std::fill(end(), m_data + count, copy);
+        }
+        m_size = count;
+    }
+
+    void swap(SmallVector& other) noexcept {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+private:
+    bool is_inline() const noexcept {
+        return m_data == m_inline;
+    }
+
+    void release() noexcept {
+        if (!is_inline())
+            delete[] m_data;
+        m_data = m_inline;
+        m_capacity = N;
+        m_size = 0;
+    }
+
+    // takes the heap buffer of the other vector or copies its inline elements, leaves it empty
+    void steal(SmallVector& other) noexcept {
+        if (other.is_inline()) {
+            std::copy(other.begin(), other.end(), m_inline);
+        } else {
+            m_data = other.m_data;
+            m_capacity = other.m_capacity;
+            other.m_data = other.m_inline;
+            other.m_capacity = N;
+        }
+        m_size = other.m_size;
+        other.m_size = 0;
+    }
+
+    void make_gap(size_type idx, size_type count) {
+        reserve(m_size + count);
+        std::copy_backward(m_data + idx, end(), end() + count);
+        m_size += count;
+    }
+
+    T m_inline[N];
+    T* m_data = m_inline;
+    size_type m_capacity = N;
+    size_type m_size = 0;
+};
+
+template <typename T, size_t N>
+bool operator==(const SmallVector<T, N>& lhs, const SmallVector<T, N>& rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, size_t N>
+bool operator!=(const SmallVector<T, N>& lhs, const SmallVector<T, N>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T, size_t N>
+void swap(SmallVector<T, N>& lhs, SmallVector<T, N>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -9,6 +9,7 @@
 #include "ngraph/op/util/attr_types.hpp"
 #include "openvino/core/attribute_adapter.hpp"
 #include "static_dimension.hpp"
+#include "small_vector.hpp"
 #include "openvino/core/rank.hpp"
 #include "openvino/core/shape.hpp"
 #include "openvino/core/partial_shape.hpp"
@@ -22,12 +23,15 @@ namespace op {
 namespace intel_cpu {
 
 /// \brief Class representing a shape that must be totally static.
-class StaticShape : public std::vector<StaticDimension>  {
+/// Dimensions are kept inline up to the typical rank, so the shape inference doesn't touch the heap.
+class StaticShape : public SmallVector<StaticDimension, 6>  {
 public:
+    using Base = SmallVector<StaticDimension, 6>;
+
     StaticShape() = default;
     StaticShape(std::initializer_list<StaticDimension> init);
     StaticShape(const std::vector<StaticDimension::value_type>& dimensions);
-    StaticShape(std::vector<StaticDimension> dimensions);
+    StaticShape(const std::vector<StaticDimension>& dimensions);
 
     StaticShape(const PartialShape &) {
         OPENVINO_UNREACHABLE("[shape infer] Shouldn't convert from PartialShape to StaticShape at runtime.");
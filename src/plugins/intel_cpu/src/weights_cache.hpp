@@ -5,6 +5,8 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "ie_parallel.hpp"
+#include "openvino/util/common_util.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -25,26 +27,12 @@ namespace intel_cpu {
 
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
+    // Computes 64-bit hash of the data, big blobs are split into the chunks hashed in parallel
     uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
+        return ov::util::hash_data_chunked(data, size, [](size_t work_amount, const std::function<void(size_t)>& body) {
+            InferenceEngine::parallel_for(work_amount, body);
+        });
     }
-
-protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
 };
 
 /**
@@ -9,6 +9,7 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <gtest/gtest.h>
 
@@ -113,6 +114,47 @@ TEST_F(OVClassConfigTestCPU, smoke_CheckModelStreamsHasHigherPriorityThanThrough
     ASSERT_EQ(streams, value);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_TransformationsProfileIsCollectedWithProfiling) {
+    ov::Core ie;
+    std::string profile;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    ASSERT_NO_THROW(profile = compiledModel.get_property(ov::intel_cpu::transformations_profile));
+    ASSERT_TRUE(profile.empty());
+
+    ov::CompiledModel profiledModel = ie.compile_model(model, deviceName, ov::enable_profiling(true));
+    ASSERT_NO_THROW(profile = profiledModel.get_property(ov::intel_cpu::transformations_profile));
+    ASSERT_NE(profile.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(profile.find("ConvertPrecision\""), std::string::npos);
+    ASSERT_NE(profile.find("\"matcher_hits\""), std::string::npos);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_RuntimeCacheIsSharedBetweenCompiledModels) {
+    ov::Core ie;
+    std::map<std::string, uint64_t> stat;
+
+    ov::CompiledModel compiledModel = ie.compile_model(model, deviceName);
+    ASSERT_NO_THROW(stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics));
+    const auto misses = stat["MISSES"];
+    const auto hits = stat["HITS"];
+    ASSERT_GT(misses, 0u);
+
+    // the same model compiled by the same core reuses the primitives of the first one
+    ov::CompiledModel sharedModel = ie.compile_model(model, deviceName);
+    ASSERT_NO_THROW(stat = sharedModel.get_property(ov::intel_cpu::runtime_cache_statistics));
+    ASSERT_EQ(stat["MISSES"], misses);
+    ASSERT_GT(stat["HITS"], hits);
+    const auto sharedHits = stat["HITS"];
+
+    // a model with its own cache compiles everything again and does not touch the shared cache
+    ov::CompiledModel isolatedModel = ie.compile_model(model, deviceName, {{"CPU_RUNTIME_CACHE_PER_NETWORK", "YES"}});
+    ASSERT_NO_THROW(stat = isolatedModel.get_property(ov::intel_cpu::runtime_cache_statistics));
+    ASSERT_EQ(stat["MISSES"], misses);
+    ASSERT_NO_THROW(stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics));
+    ASSERT_EQ(stat["MISSES"], misses);
+    ASSERT_EQ(stat["HITS"], sharedHits);
+}
+
 const std::vector<ov::AnyMap> multiDevicePriorityConfigs = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU)}};
 
@@ -18,6 +18,33 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test,
                 ::testing::ValuesIn(num_requests),
                 ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_PartialBatch,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(get_vs_set),
+                ::testing::Values(1),
+                ::testing::Values(3, 9),
+                ::testing::Values(4, 8)),
+                         AutoBatching_Test_PartialBatch::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_Gather,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(false),
+                ::testing::Values(1),
+                ::testing::Values(3, 8, 9),
+                ::testing::Values(4, 8)),
+                         AutoBatching_Test_Gather::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_AdaptiveTimeout,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::ValuesIn(get_vs_set),
+                ::testing::Values(1),
+                ::testing::Values(3),
+                ::testing::Values(4, 8)),
+                         AutoBatching_Test_AdaptiveTimeout::getTestCaseName);
 // TODO: for 22.2 (CVS-68949)
 //INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_CPU, AutoBatching_Test_DetectionOutput,
 //                         ::testing::Combine(
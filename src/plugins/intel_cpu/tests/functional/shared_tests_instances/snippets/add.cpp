@@ -2,8 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <set>
+
 #include "snippets/add.hpp"
 #include "common_test_utils/test_constants.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 namespace ov {
 namespace test {
@@ -38,6 +41,55 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise, AddSinhConst,
                              ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                      AddSinhConst::getTestCaseName);
 
+// the shapes are revisited to reuse the cached kernels, the second shape has the tails in every dimension
+const auto addSinhDynamicParams = ::testing::Combine(
+        ::testing::Values(InputShape{{1, -1, -1, -1},
+                                     {{1, 42, 16, 64}, {1, 3, 5, 7}, {1, 42, 16, 64}, {1, 3, 5, 7}}}),
+        ::testing::Values(InputShape{{1, -1, -1, -1},
+                                     {{1, 42, 16, 1}, {1, 3, 5, 7}, {1, 42, 16, 1}, {1, 3, 5, 7}}},
+                          InputShape{{1, -1, -1, -1},
+                                     {{1, 42, 16, 64}, {1, 1, 5, 1}, {1, 42, 16, 64}, {1, 1, 5, 1}}}),
+        ::testing::Values(3), // Add + 2 converts after inputs
+        ::testing::Values(1), // Subgraph is created, since the inputs are followed by converts
+        ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise, AddSinhDynamic, addSinhDynamicParams, AddSinhDynamic::getTestCaseName);
+
+// The snippet kernels are kept in the runtime cache by the SnippetKey, so a shape seen before is executed
+// without a new JIT compilation, i.e. without a cache miss
+class AddSinhDynamicKernelReuse : public AddSinhDynamic {
+protected:
+    void infer() override {
+        std::vector<ov::Shape> shapes;
+        for (const auto& param : function->get_parameters())
+            shapes.push_back(inputs.at(param).get_shape());
+        const bool seen = !seenShapes.insert(shapes).second;
+
+        const auto missesBefore = getCacheMisses();
+        AddSinhDynamic::infer();
+        const auto misses = getCacheMisses();
+        if (seen) {
+            EXPECT_EQ(misses, missesBefore) << "the kernels are compiled again for the shapes "
+                                            << CommonTestUtils::vec2str(shapes);
+        }
+    }
+
+    uint64_t getCacheMisses() {
+        auto stat = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+        return stat["MISSES"];
+    }
+
+    std::set<std::vector<ov::Shape>> seenShapes;
+};
+
+TEST_P(AddSinhDynamicKernelReuse, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Eltwise, AddSinhDynamicKernelReuse, addSinhDynamicParams,
+                         AddSinhDynamic::getTestCaseName);
+
 }  // namespace
 } // namespace snippets
 } // namespace test
@@ -0,0 +1,46 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/softmax.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Softmax, SoftmaxSinh,
+                     ::testing::Combine(
+                             ::testing::Values(ov::Shape {1, 12, 16, 64},
+                                               ov::Shape {1, 3, 10, 19},   // vector and scalar tiles
+                                               ov::Shape {2, 5, 3}),       // scalar tile only
+                             ::testing::Values(2), // Sinh + Subgraph
+                             ::testing::Values(1), // Softmax is decomposed inside the Subgraph
+                             ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                     SoftmaxSinh::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LayerNorm, AddLayerNormSinh,
+                     ::testing::Combine(
+                             ::testing::Values(ov::Shape {1, 128, 768}),
+                             ::testing::Values(ov::Shape {1, 128, 768}),
+                             ::testing::Values(3), // 2 Sinh + Subgraph
+                             ::testing::Values(1), // Add, MVN, Multiply and Add are fused into one Subgraph
+                             ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                     AddLayerNormSinh::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LayerNorm_Tail, AddLayerNormSinh,
+                     ::testing::Combine(
+                             ::testing::Values(ov::Shape {2, 7, 37}),
+                             ::testing::Values(ov::Shape {2, 1, 37}),
+                             ::testing::Values(3), // 2 Sinh + Subgraph
+                             ::testing::Values(1), // Add, MVN, Multiply and Add are fused into one Subgraph
+                             ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                     AddLayerNormSinh::getTestCaseName);
+
+}  // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,117 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+#include <cstring>
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+// The exported blob is followed by the reordered constants, so the imported network skips the constant subgraphs and
+// uses the imported data in place.
+class ExportImportCompiledConstants : public ::testing::TestWithParam<int32_t> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<int32_t> obj) {
+        std::ostringstream result;
+        result << "streams=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ov::Model> create_test_function() {
+        auto param = std::make_shared<opset8::Parameter>(element::f32, Shape{1, 8, 16, 16});
+        auto conv = builder::makeConvolution(param, element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16, false);
+        auto relu = std::make_shared<opset8::Relu>(conv);
+        // the constant is not per channel, so it is not fused into the convolution: it is reordered into the blocked
+        // layout of the convolution output by a constant Reorder node, whose output is a compiled constant
+        std::vector<float> scales(16 * 16 * 16);
+        for (size_t i = 0; i < scales.size(); i++)
+            scales[i] = static_cast<float>(i % 5) * 0.25f;
+        auto scale = std::make_shared<opset8::Constant>(element::f32, Shape{1, 16, 16, 16}, scales);
+        auto mul = std::make_shared<opset8::Multiply>(relu, scale);
+        auto result = std::make_shared<opset8::Result>(mul);
+        return std::make_shared<ov::Model>(ResultVector{result}, ParameterVector{param});
+    }
+
+    static std::vector<float> infer(ov::CompiledModel& compiled_model, const ov::Tensor& input) {
+        auto req = compiled_model.create_infer_request();
+        req.set_input_tensor(input);
+        req.infer();
+        auto output = req.get_output_tensor();
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    // the number of the constants stored after the network, or -1 if the section is absent
+    static int64_t compiled_constants_count(const std::string& blob) {
+        const std::string magic = "CPUCONST";
+        const auto pos = blob.rfind(magic);
+        if (pos == std::string::npos)
+            return -1;
+        uint64_t count = 0;
+        std::memcpy(&count, blob.data() + pos + magic.size() + sizeof(uint32_t), sizeof count);
+        return static_cast<int64_t>(count);
+    }
+
+    void import_and_compare(std::shared_ptr<ov::Core> core, const std::string& blob,
+                            const ov::Tensor& input, const std::vector<float>& expected) {
+        // the stream may carry other blobs after the network, e.g. in case of HETERO
+        const std::string tail = "TAIL";
+        std::stringstream stream(blob + tail);
+        auto imported = core->import_model(stream, "CPU", {ov::num_streams(GetParam())});
+
+        std::string rest((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(tail, rest);
+        EXPECT_EQ(expected, infer(imported, input));
+    }
+};
+
+TEST_P(ExportImportCompiledConstants, RoundTrip) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU", {ov::num_streams(GetParam())});
+
+    auto input = ov::Tensor(element::f32, Shape{1, 8, 16, 16});
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<float>(i % 17) - 8.f;
+    const auto expected = infer(compiled_model, input);
+
+    std::stringstream stream;
+    compiled_model.export_model(stream);
+    const auto blob = stream.str();
+    ASSERT_GT(compiled_constants_count(blob), 0);
+
+    import_and_compare(core, blob, input, expected);
+}
+
+TEST_P(ExportImportCompiledConstants, WithoutCompiledConstants) {
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiled_model = core->compile_model(create_test_function(), "CPU", {ov::num_streams(GetParam())});
+
+    auto input = ov::Tensor(element::f32, Shape{1, 8, 16, 16});
+    auto data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        data[i] = static_cast<float>(i % 17) - 8.f;
+    const auto expected = infer(compiled_model, input);
+
+    std::stringstream stream;
+    compiled_model.export_model(stream);
+    const auto blob = stream.str();
+
+    // a blob exported by the older plugin, the constant subgraphs are executed on import
+    const auto pos = blob.rfind("CPUCONST");
+    ASSERT_NE(std::string::npos, pos);
+    import_and_compare(core, blob.substr(0, pos), input, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ExportImportCompiledConstants, ExportImportCompiledConstants,
+                         ::testing::Values(1, 2),
+                         ExportImportCompiledConstants::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -111,14 +111,10 @@ static std::shared_ptr<ov::Model> initMHASubgraph1(std::vector<ov::PartialShape>
     auto transpose2Param = std::make_shared<ngraph::opset1::Parameter>(inputPrecisions[3], inputDynamicShapes[3]);
     ngraphParam.push_back(transpose2Param);
 
+    const auto rank = static_cast<size_t>(inputDynamicShapes[0].rank().get_length());
     std::vector<ov::Shape> constantShapes;
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
-    constantShapes.push_back(ov::Shape({1, inputDynamicShapes[0].get_shape()[2], 1, 1}));
-    constantShapes.push_back(ov::Shape({2}));
-    constantShapes.push_back(ov::Shape({4}));
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
+    constantShapes.push_back(ov::Shape({rank}));
+    constantShapes.push_back(ov::Shape({rank}));
 
     std::vector<int64_t> transpose0ConstData = {0, 2, 1, 3};
     auto transpose0Const = ngraph::builder::makeConstant(ElementType::i64, constantShapes[0], transpose0ConstData);
@@ -271,6 +267,31 @@ INSTANTIATE_TEST_SUITE_P(smoke_MHA, MHATest,
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         MHATest::getTestCaseName);
 
+std::vector<std::vector<InputShape>> inputShapesDynamic = {
+    {
+        {{-1, -1, 16, 64}, {{2, 8, 16, 64}, {1, 300, 16, 64}, {3, 128, 16, 64}, {2, 8, 16, 64}}},
+        {{-1, -1, 16, 64}, {{2, 8, 16, 64}, {1, 300, 16, 64}, {3, 128, 16, 64}, {2, 8, 16, 64}}},
+        {{-1, 1, 1, -1}, {{2, 1, 1, 8}, {1, 1, 1, 300}, {3, 1, 1, 128}, {2, 1, 1, 8}}},
+        {{-1, -1, 16, 64}, {{2, 8, 16, 64}, {1, 300, 16, 64}, {3, 128, 16, 64}, {2, 8, 16, 64}}},
+    },
+    {
+        {{1, -1, 12, 80}, {{1, 77, 12, 80}, {1, 257, 12, 80}}},
+        {{1, -1, 12, 80}, {{1, 77, 12, 80}, {1, 257, 12, 80}}},
+        {{1, 1, 1, -1}, {{1, 1, 1, 77}, {1, 1, 1, 257}}},
+        {{1, -1, 12, 80}, {{1, 77, 12, 80}, {1, 257, 12, 80}}},
+    },
+};
+
+// only the pattern without reshapes may be fused for dynamic shapes
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_Dynamic, MHATest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapesDynamic),
+                                ::testing::ValuesIn(inputPrecisions),
+                                ::testing::ValuesIn(matMulIn0Precisions),
+                                ::testing::Values(1),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        MHATest::getTestCaseName);
+
 } // namespace
 
 static std::shared_ptr<ov::Model> initMHAQuantSubgraph0(std::vector<ov::PartialShape>& inputDynamicShapes, std::vector<ElementType>& inputPrecisions,
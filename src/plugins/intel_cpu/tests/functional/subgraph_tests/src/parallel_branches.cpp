@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* Inception-like block executed with the CPU_PARALLEL_BRANCHES mode:
+
+             Param
+       ________|________
+      |        |        |
+    Conv     Conv    MaxPool
+      |        |        |
+    Relu     Conv     Conv
+      |________|________|
+               |
+             Concat
+               |
+             Result
+*/
+class ParallelBranchesCPUTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({"CPU_PARALLEL_BRANCHES", InferenceEngine::PluginConfigParams::YES});
+
+        const auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel) {
+            const std::vector<ptrdiff_t> pad = {static_cast<ptrdiff_t>(kernel / 2), static_cast<ptrdiff_t>(kernel / 2)};
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, pad, pad, {1, 1},
+                                            op::PadType::EXPLICIT, 8);
+        };
+
+        auto branch1 = std::make_shared<opset1::Relu>(makeConv(inputParams[0], 1));
+        auto branch2 = makeConv(makeConv(inputParams[0], 1), 3);
+        auto pool = builder::makePooling(inputParams[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch3 = makeConv(pool, 1);
+
+        auto concat = builder::makeConcat(OutputVector{branch1, branch2, branch3}, 1);
+
+        ResultVector results{std::make_shared<opset1::Result>(concat)};
+        function = std::make_shared<Function>(results, inputParams, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesCPUTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using PreprocessFusionParams = std::tuple<ElementType,   // input precision
+                                          size_t>;       // convolution input channels
+
+/* The preprocessing chain of the input is executed by the single Preprocess node,
+   which writes the layout required by the convolution:
+
+        Param (NHWC)
+          |
+       Convert
+          |
+       Subtract
+          |
+        Divide
+          |
+       Transpose
+          |
+      Convolution
+          |
+        Result
+*/
+class PreprocessFusionTest : public testing::WithParamInterface<PreprocessFusionParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PreprocessFusionParams>& obj) {
+        ElementType inType;
+        size_t channels;
+        std::tie(inType, channels) = obj.param;
+        std::ostringstream result;
+        result << "inType=" << inType << "_C=" << channels;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        ElementType inType;
+        size_t channels;
+        std::tie(inType, channels) = this->GetParam();
+
+        init_input_shapes({{{}, {{1, 37, 29, channels}}}});
+        auto inputParams = ngraph::builder::makeDynamicParams(inType, inputDynamicShapes);
+
+        std::shared_ptr<ngraph::Node> data = inputParams.front();
+        if (inType != ElementType::f32)
+            data = std::make_shared<ngraph::opset1::Convert>(data, ElementType::f32);
+        auto mean = ngraph::builder::makeConstant<float>(ElementType::f32, {1, 1, 1, channels}, {}, true, 128.f);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(data, mean);
+        auto scale = ngraph::builder::makeConstant<float>(ElementType::f32, {1, 1, 1, channels}, {}, true, 64.f, 1.f);
+        auto divide = std::make_shared<ngraph::opset1::Divide>(subtract, scale);
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(divide,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{4}, {0, 3, 1, 2}));
+        auto conv = ngraph::builder::makeConvolution(transpose, ElementType::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 16);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "PreprocessFusion");
+    }
+};
+
+TEST_P(PreprocessFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_PreprocessFusion, PreprocessFusionTest,
+                         ::testing::Combine(::testing::Values(ElementType::u8, ElementType::f32),
+                                            ::testing::Values(3, 16, 20)),
+                         PreprocessFusionTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The shapes processing results of the dynamic graph are reused for the repeated input shapes.
+   Reshape target shape is computed from the input shape, so its shape inference is not reused:
+
+        Param
+        /   \
+  Multiply  ShapeOf
+       |      |
+       |    Gather
+       |      |
+       |    Concat
+        \   /
+       Reshape
+          |
+       Softmax
+          |
+        Result
+
+   The parameters of Multiply are restored from the snapshot for the repeated shapes instead of being prepared,
+   so its executor is not even looked up in the runtime cache. Hence a repeated shape makes fewer cache lookups
+   than its first occurrence and no cache misses at all.
+*/
+class RepeatedInputShapes : public SubgraphBaseTest {
+protected:
+    void infer() override {
+        const auto shape = inputs.begin()->second.get_shape();
+        const auto before = getCacheStatistics();
+        SubgraphBaseTest::infer();
+        const auto after = getCacheStatistics();
+
+        const auto lookups = after.at("HITS") + after.at("MISSES") - before.at("HITS") - before.at("MISSES");
+        auto first = firstLookups.find(shape);
+        if (first == firstLookups.end()) {
+            firstLookups[shape] = lookups;
+        } else {
+            EXPECT_EQ(after.at("MISSES"), before.at("MISSES")) << "for the repeated shape " << shape;
+            EXPECT_LT(lookups, first->second) << "the parameters are prepared again for the repeated shape " << shape;
+        }
+    }
+
+    std::map<std::string, uint64_t> getCacheStatistics() {
+        return compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+    }
+
+    // the runtime cache lookups made by the first inference with the shape
+    std::map<ov::Shape, uint64_t> firstLookups;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShapes{{-1, -1, 16}, {{1, 10, 16}, {2, 5, 16}, {1, 10, 16}, {3, 7, 16}, {2, 5, 16}, {1, 10, 16}}};
+
+        init_input_shapes({inputShapes});
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+
+        auto scale = ngraph::builder::makeConstant<float>(ngPrc, {16}, {}, true);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(inputParams.front(), scale);
+
+        auto shapeOf = std::make_shared<ngraph::opset3::ShapeOf>(inputParams.front(), ngraph::element::i32);
+        auto batch = std::make_shared<ngraph::opset8::Gather>(shapeOf,
+                                                              ngraph::opset1::Constant::create(ngraph::element::i32, {1}, {0}),
+                                                              ngraph::opset1::Constant::create(ngraph::element::i32, {}, {0}));
+        auto targetShape = std::make_shared<ngraph::opset1::Concat>(
+                ngraph::OutputVector{batch, ngraph::opset1::Constant::create(ngraph::element::i32, {1}, {-1})}, 0);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, targetShape, false);
+
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(reshape, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(softmax)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "RepeatedInputShapes");
+    }
+};
+
+TEST_F(RepeatedInputShapes, smoke_RepeatedInputShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,226 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/op/util/variable.hpp>
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+/* The variable state is double buffered: ReadValue reads the current buffer while Assign writes the next one,
+   and the buffers are swapped after the inference. The previous value is also returned, so the test detects
+   the case when Assign overwrites the buffer which is still read in the same inference:
+
+        Param   ReadValue
+           \    /      \
+            Add        Result "prev"
+           /    \
+      Assign    Result "acc"
+
+   Add has two consumers here, so it can't write into the state buffer and the memory nodes copy the state.
+*/
+class StateDoubleBuffering : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+                ov::op::util::VariableInfo{shape, ov::element::f32, variableId});
+        auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0});
+        auto read = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        read->set_friendly_name(readName);
+        auto add = std::make_shared<ov::opset8::Add>(read, param);
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        assign->set_friendly_name(assignName);
+
+        auto accResult = std::make_shared<ov::opset8::Result>(add);
+        accResult->get_output_tensor(0).set_names({"acc"});
+        auto prevResult = std::make_shared<ov::opset8::Result>(read);
+        prevResult->get_output_tensor(0).set_names({"prev"});
+
+        model = std::make_shared<ov::Model>(ov::ResultVector{accResult, prevResult},
+                                            ov::SinkVector{assign},
+                                            ov::ParameterVector{param},
+                                            "StateDoubleBuffering");
+    }
+
+    static void expectAll(const ov::Tensor& tensor, float value) {
+        const auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            ASSERT_EQ(data[i], value) << "at index " << i;
+        }
+    }
+
+    // the memory nodes are reported as optimized out when the state is bound in place and not copied
+    void expectStateCopied(ov::InferRequest& request, bool copied) {
+        const auto perfCounts = request.get_profiling_info();
+        for (const auto& name : {readName, assignName}) {
+            auto info = std::find_if(perfCounts.begin(), perfCounts.end(), [&](const ov::ProfilingInfo& info) {
+                return info.node_name == name;
+            });
+            ASSERT_NE(info, perfCounts.end()) << "no performance counters for " << name;
+            if (copied) {
+                ASSERT_NE(info->status, ov::ProfilingInfo::Status::OPTIMIZED_OUT) << name;
+            } else {
+                ASSERT_EQ(info->status, ov::ProfilingInfo::Status::OPTIMIZED_OUT) << name;
+            }
+        }
+    }
+
+    ov::InferRequest createRequest() {
+        auto core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(model, "CPU", ov::enable_profiling(true));
+        return compiledModel.create_infer_request();
+    }
+
+    void infer(ov::InferRequest& request, float value) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), value);
+        request.set_input_tensor(input);
+        request.infer();
+    }
+
+    const ov::Shape shape{1, 64};
+    const std::string variableId = "accumulator";
+    const std::string readName = "read";
+    const std::string assignName = "assign";
+    std::shared_ptr<ov::Model> model;
+};
+
+/* Add is the only consumer of ReadValue besides the "prev" output and Assign is the only consumer of Add,
+   so ReadValue consumers read the current buffer and Add writes the next one directly:
+
+        Param   ReadValue
+           \    /      \
+            Add        Result "prev"
+             |
+          Assign
+*/
+class StateDoubleBufferingInPlace : public StateDoubleBuffering {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+                ov::op::util::VariableInfo{shape, ov::element::f32, variableId});
+        auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0});
+        auto read = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        read->set_friendly_name(readName);
+        auto add = std::make_shared<ov::opset8::Add>(read, param);
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        assign->set_friendly_name(assignName);
+
+        auto prevResult = std::make_shared<ov::opset8::Result>(read);
+        prevResult->get_output_tensor(0).set_names({"prev"});
+
+        model = std::make_shared<ov::Model>(ov::ResultVector{prevResult},
+                                            ov::SinkVector{assign},
+                                            ov::ParameterVector{param},
+                                            "StateDoubleBufferingInPlace");
+    }
+};
+
+TEST_F(StateDoubleBuffering, smoke_ValuesAcrossInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = createRequest();
+    for (int i = 1; i <= 5; ++i) {
+        infer(request, 1.f);
+        expectAll(request.get_tensor("prev"), static_cast<float>(i - 1));
+        expectAll(request.get_tensor("acc"), static_cast<float>(i));
+
+        auto states = request.query_state();
+        ASSERT_EQ(states.size(), 1);
+        ASSERT_EQ(states[0].get_name(), variableId);
+        expectAll(states[0].get_state(), static_cast<float>(i));
+    }
+    expectStateCopied(request, true);
+}
+
+TEST_F(StateDoubleBuffering, smoke_ResetAndSetState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = createRequest();
+    infer(request, 2.f);
+    infer(request, 2.f);
+    expectAll(request.get_tensor("acc"), 4.f);
+
+    for (auto&& state : request.query_state()) {
+        state.reset();
+    }
+    infer(request, 2.f);
+    expectAll(request.get_tensor("prev"), 0.f);
+    expectAll(request.get_tensor("acc"), 2.f);
+    infer(request, 2.f);
+    expectAll(request.get_tensor("prev"), 2.f);
+    expectAll(request.get_tensor("acc"), 4.f);
+
+    ov::Tensor value(ov::element::f32, shape);
+    std::fill_n(value.data<float>(), value.get_size(), 10.f);
+    request.query_state()[0].set_state(value);
+    infer(request, 1.f);
+    expectAll(request.get_tensor("prev"), 10.f);
+    expectAll(request.get_tensor("acc"), 11.f);
+    infer(request, 1.f);
+    expectAll(request.get_tensor("acc"), 12.f);
+}
+
+TEST_F(StateDoubleBuffering, smoke_RequestsHaveOwnStates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(model, "CPU");
+    auto first = compiledModel.create_infer_request();
+    auto second = compiledModel.create_infer_request();
+
+    for (int i = 1; i <= 3; ++i) {
+        infer(first, 1.f);
+        infer(second, 3.f);
+        expectAll(first.get_tensor("acc"), static_cast<float>(i));
+        expectAll(second.get_tensor("acc"), static_cast<float>(3 * i));
+    }
+}
+
+TEST_F(StateDoubleBufferingInPlace, smoke_ValuesAcrossInferences) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = createRequest();
+    for (int i = 1; i <= 5; ++i) {
+        infer(request, 1.f);
+        expectAll(request.get_tensor("prev"), static_cast<float>(i - 1));
+        expectStateCopied(request, false);
+
+        auto states = request.query_state();
+        ASSERT_EQ(states.size(), 1);
+        ASSERT_EQ(states[0].get_name(), variableId);
+        expectAll(states[0].get_state(), static_cast<float>(i));
+    }
+}
+
+TEST_F(StateDoubleBufferingInPlace, smoke_SetAndGetState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto request = createRequest();
+    infer(request, 2.f);
+    infer(request, 2.f);
+    infer(request, 2.f);
+
+    // the buffers have been swapped an odd number of times, the state must follow the current one
+    ov::Tensor value(ov::element::f32, shape);
+    std::fill_n(value.data<float>(), value.get_size(), 10.f);
+    auto state = request.query_state()[0];
+    state.set_state(value);
+    expectAll(state.get_state(), 10.f);
+
+    for (int i = 1; i <= 4; ++i) {
+        infer(request, 1.f);
+        expectAll(request.get_tensor("prev"), 10.f + static_cast<float>(i - 1));
+        expectAll(state.get_state(), 10.f + static_cast<float>(i));
+        expectStateCopied(request, false);
+    }
+
+    state.reset();
+    expectAll(state.get_state(), 0.f);
+    infer(request, 3.f);
+    expectAll(request.get_tensor("prev"), 0.f);
+    expectAll(state.get_state(), 3.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
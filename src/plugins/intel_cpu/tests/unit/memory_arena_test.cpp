@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory_arena.h>
+
+using namespace ov::intel_cpu;
+
+TEST(DynamicMemoryArenaTest, RepacksOutgrownBoxes) {
+    DynamicMemoryArena arena;
+    // box {start, finish, size, id}, the size is ignored by the arena
+    auto mngr0 = arena.addBox({0, 1, -1, 0});
+    auto mngr1 = arena.addBox({1, 2, -1, 1});
+    auto mngr2 = arena.addBox({2, 3, -1, 2});
+
+    // nothing has been requested yet
+    ASSERT_FALSE(arena.solve());
+
+    // first inference, the boxes are served from private buffers
+    ASSERT_TRUE(mngr0->resize(1024));
+    ASSERT_TRUE(mngr1->resize(2048));
+    ASSERT_TRUE(mngr2->resize(512));
+    ASSERT_TRUE(arena.solve());
+
+    auto ptr0 = static_cast<uint8_t*>(mngr0->getRawPtr());
+    auto ptr1 = static_cast<uint8_t*>(mngr1->getRawPtr());
+    auto ptr2 = static_cast<uint8_t*>(mngr2->getRawPtr());
+    // overlapping live times must not share memory
+    ASSERT_TRUE(ptr0 + 1024 <= ptr1 || ptr1 + 2048 <= ptr0);
+    ASSERT_TRUE(ptr1 + 2048 <= ptr2 || ptr2 + 512 <= ptr1);
+
+    // the same or smaller sizes fit into the slots
+    ASSERT_FALSE(mngr0->resize(1024));
+    ASSERT_FALSE(mngr1->resize(16));
+    ASSERT_FALSE(arena.solve());
+    ASSERT_EQ(ptr0, mngr0->getRawPtr());
+
+    // a bigger shape moves the box out of the arena until the next solve
+    ASSERT_TRUE(mngr2->resize(4096));
+    ASSERT_TRUE(arena.solve());
+    ptr1 = static_cast<uint8_t*>(mngr1->getRawPtr());
+    ptr2 = static_cast<uint8_t*>(mngr2->getRawPtr());
+    ASSERT_TRUE(ptr1 + 2048 <= ptr2 || ptr2 + 4096 <= ptr1);
+    ASSERT_FALSE(mngr2->resize(4096));
+}
+
+TEST(DynamicMemoryArenaTest, ExternalBufferDetachesBox) {
+    DynamicMemoryArena arena;
+    auto mngr = arena.addBox({0, 1, -1, 0});
+
+    std::vector<uint8_t> external(256);
+    mngr->setExtBuff(external.data(), external.size());
+    ASSERT_TRUE(mngr->hasExtBuffer());
+    ASSERT_FALSE(mngr->resize(128));
+    ASSERT_FALSE(arena.solve());
+    ASSERT_EQ(external.data(), mngr->getRawPtr());
+}
+
+TEST(DynamicMemoryArenaTest, ManagerOutlivesArena) {
+    DnnlMemoryMngrPtr mngr;
+    {
+        DynamicMemoryArena arena;
+        mngr = arena.addBox({0, 1, -1, 0});
+    }
+    // the growth is recorded in the flag shared with the destroyed arena
+    ASSERT_TRUE(mngr->resize(1024));
+    ASSERT_NE(nullptr, mngr->getRawPtr());
+}
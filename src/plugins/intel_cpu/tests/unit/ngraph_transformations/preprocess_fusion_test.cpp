@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph_transformations/preprocess_fusion.hpp>
+#include <ngraph_transformations/op/preprocess.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, PreprocessFusionNHWCToNCHW) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    const std::vector<float> mean{123.f, 117.f, 104.f}, scale{58.f, 57.f, 57.5f};
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 224, 224, 3 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input, ngraph::element::f32);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 3 }, mean));
+        auto divide = std::make_shared<ngraph::opset1::Divide>(subtract,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 1, 3 }, scale));
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(divide,
+            ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 4 }, { 0, 3, 1, 2 }));
+        auto relu = std::make_shared<ngraph::opset1::Relu>(transpose);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<PreprocessFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        std::vector<float> scales(3), shifts(3);
+        for (size_t c = 0; c < 3; c++) {
+            scales[c] = 1.f / scale[c];
+            shifts[c] = -mean[c] / scale[c];
+        }
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 224, 224, 3 });
+        auto preprocess = std::make_shared<PreprocessNode>(input, scales, shifts, true, ngraph::element::f32);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, PreprocessFusionPlanarDynamic) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 3, -1, -1 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(input,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 3, 1, 1 }, { 1.f, 2.f, 3.f }));
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 0.5f }), subtract);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(multiply);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<PreprocessFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::PartialShape{ -1, 3, -1, -1 });
+        auto preprocess = std::make_shared<PreprocessNode>(input, std::vector<float>{ 0.5f, 0.5f, 0.5f },
+                                                           std::vector<float>{ -0.5f, -1.f, -1.5f }, false, ngraph::element::f32);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, PreprocessFusionNotPerChannel) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    auto create = []() {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 3, 4, 4 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input, ngraph::element::f32);
+        // the constant differs along the spatial axes
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 1, 4, 1 }, { 1.f, 2.f, 3.f, 4.f }));
+        auto relu = std::make_shared<ngraph::opset1::Relu>(subtract);
+        return std::make_shared<ngraph::Function>(ngraph::NodeVector{ relu }, ngraph::ParameterVector{ input });
+    };
+    {
+        f = create();
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<PreprocessFusion>();
+        m.run_passes(f);
+    }
+    f_ref = create();
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, PreprocessFusionIntermediateConsumer) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 3, 4, 4 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(input, ngraph::element::f32);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 3, 1, 1 }, { 1.f, 2.f, 3.f }));
+        // Subtract has two consumers, the chain stops there
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 2.f }));
+        auto relu = std::make_shared<ngraph::opset1::Relu>(subtract);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ multiply, relu }, ngraph::ParameterVector{ input });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<PreprocessFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ 1, 3, 4, 4 });
+        auto preprocess = std::make_shared<PreprocessNode>(input, std::vector<float>{ 1.f, 1.f, 1.f },
+                                                           std::vector<float>{ -1.f, -2.f, -3.f }, false, ngraph::element::f32);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(preprocess,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{}, { 2.f }));
+        auto relu = std::make_shared<ngraph::opset1::Relu>(preprocess);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ multiply, relu }, ngraph::ParameterVector{ input });
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
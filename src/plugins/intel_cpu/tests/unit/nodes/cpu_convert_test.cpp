@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <nodes/common/cpu_convert.h>
+#include <openvino/core/type/float16.hpp>
+#include <utils/bfloat16.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace {
+// covers several blocks of the parallel split, the vector loop and the scalar tail
+const std::vector<size_t> convertSizes = {1, 7, 17, 100003};
+
+std::vector<float> makeValues(size_t size, float lbound, float ubound) {
+    std::vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+        values[i] = lbound + (ubound - lbound) * static_cast<float>((i * 7919) % 1000) / 1000.f;
+    return values;
+}
+}   // namespace
+
+TEST(CpuConvertTest, FP16ToFP32) {
+    for (auto size : convertSizes) {
+        const auto values = makeValues(size, -1000.f, 1000.f);
+        std::vector<ov::float16> src(values.begin(), values.end());
+        std::vector<float> dst(size);
+        cpu_convert(src.data(), dst.data(), Precision::FP16, Precision::FP32, size);
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(dst[i], static_cast<float>(src[i])) << "size " << size << " index " << i;
+    }
+}
+
+TEST(CpuConvertTest, FP32ToFP16Clamped) {
+    for (auto size : convertSizes) {
+        auto src = makeValues(size, -1000.f, 1000.f);
+        src[0] = 1e6f;
+        std::vector<ov::float16> dst(size);
+        cpu_convert(src.data(), dst.data(), Precision::FP32, Precision::FP16, size);
+        ASSERT_EQ(static_cast<float>(dst[0]), 65504.f);
+        for (size_t i = 1; i < size; i++)
+            ASSERT_EQ(dst[i].to_bits(), ov::float16(src[i]).to_bits()) << "size " << size << " index " << i;
+    }
+}
+
+TEST(CpuConvertTest, U8ToFP32AndBF16) {
+    for (auto size : convertSizes) {
+        std::vector<uint8_t> src(size);
+        for (size_t i = 0; i < size; i++)
+            src[i] = static_cast<uint8_t>(i * 31);
+        std::vector<float> dstF32(size);
+        std::vector<bfloat16_t> dstBF16(size);
+        cpu_convert(src.data(), dstF32.data(), Precision::U8, Precision::FP32, size);
+        cpu_convert(src.data(), dstBF16.data(), Precision::U8, Precision::BF16, size);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(dstF32[i], static_cast<float>(src[i])) << "size " << size << " index " << i;
+            ASSERT_EQ(static_cast<float>(dstBF16[i]), static_cast<float>(src[i])) << "size " << size << " index " << i;
+        }
+    }
+}
+
+TEST(CpuConvertTest, FP32ToIntegerSaturatesAndTruncates) {
+    for (auto size : convertSizes) {
+        const auto src = makeValues(size, -300.f, 300.f);
+        std::vector<uint8_t> dstU8(size);
+        std::vector<int8_t> dstI8(size);
+        std::vector<int32_t> dstI32(size);
+        cpu_convert(src.data(), dstU8.data(), Precision::FP32, Precision::U8, size);
+        cpu_convert(src.data(), dstI8.data(), Precision::FP32, Precision::I8, size);
+        cpu_convert(src.data(), dstI32.data(), Precision::FP32, Precision::I32, size);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(dstU8[i], static_cast<uint8_t>(std::min(std::max(src[i], 0.f), 255.f))) << "index " << i;
+            ASSERT_EQ(dstI8[i], static_cast<int8_t>(std::min(std::max(src[i], -128.f), 127.f))) << "index " << i;
+            ASSERT_EQ(dstI32[i], static_cast<int32_t>(src[i])) << "index " << i;
+        }
+    }
+}
+
+TEST(CpuConvertTest, FP32ToFP32WithIntegerInterim) {
+    for (auto size : convertSizes) {
+        const auto src = makeValues(size, -300.f, 300.f);
+        std::vector<float> dst(size);
+        cpu_convert(src.data(), dst.data(), Precision::FP32, Precision::U8, Precision::FP32, size);
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(dst[i], std::trunc(std::min(std::max(src[i], 0.f), 255.f))) << "size " << size << " index " << i;
+    }
+}
+
+TEST(CpuConvertTest, ScaleShift) {
+    for (auto size : convertSizes) {
+        std::vector<uint8_t> src(size);
+        for (size_t i = 0; i < size; i++)
+            src[i] = static_cast<uint8_t>(i * 31);
+        std::vector<float> dstF32(size);
+        std::vector<int8_t> dstI8(size);
+        cpu_convert(src.data(), dstF32.data(), Precision::U8, Precision::FP32, size, 0.5f, -10.f);
+        cpu_convert(src.data(), dstI8.data(), Precision::U8, Precision::I8, size, 0.5f, -10.f);
+        for (size_t i = 0; i < size; i++) {
+            const float expected = static_cast<float>(src[i]) * 0.5f - 10.f;
+            ASSERT_EQ(dstF32[i], expected) << "size " << size << " index " << i;
+            ASSERT_EQ(dstI8[i], static_cast<int8_t>(std::min(expected, 127.f))) << "size " << size << " index " << i;
+        }
+    }
+}
+
+TEST(CpuConvertTest, ScaleShiftWithoutJitKernel) {
+    // the precisions aren't supported by the JIT kernel, so the values are converted by the reference loop
+    for (auto size : convertSizes) {
+        std::vector<int32_t> src(size);
+        for (size_t i = 0; i < size; i++)
+            src[i] = static_cast<int32_t>(i % 128) - 64;
+        std::vector<int32_t> dstI32(size);
+        std::vector<bfloat16_t> dstBF16(size);
+        cpu_convert(src.data(), dstI32.data(), Precision::I32, Precision::I32, size, 0.5f, 3.f);
+        cpu_convert(src.data(), dstBF16.data(), Precision::I32, Precision::BF16, size, 2.f, 0.f);
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(dstI32[i], static_cast<int32_t>(static_cast<float>(src[i]) * 0.5f + 3.f)) << "size " << size << " index " << i;
+            ASSERT_EQ(static_cast<float>(dstBF16[i]), static_cast<float>(src[i] * 2)) << "size " << size << " index " << i;
+        }
+    }
+}
@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
+#include <deque>
+#include <future>
 #include <thread>
+#include <atomic>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -152,6 +156,52 @@ TEST(CacheEntryTests, GetOrCreate) {
     }
 }
 
+TEST(CacheEntryTests, Statistics) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    CacheEntry<IntKey, ValueType> entry(capacity);
+
+    for (int i = 0; i < capacity; ++i) {
+        entry.getOrCreate({i}, builder);
+    }
+    for (int i = 0; i < capacity; ++i) {
+        entry.getOrCreate({i}, builder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        entry.getOrCreate({i}, builder);
+    }
+
+    auto stat = entry.getStatistics();
+    ASSERT_EQ(stat.hits, capacity);
+    ASSERT_EQ(stat.misses, 2 * capacity);
+    ASSERT_EQ(stat.evictions, capacity);
+}
+
+TEST(CacheEntryTests, ShardedCapacity) {
+    using ValueType = std::shared_ptr<int>;
+
+    // not a multiple of the number of the shards
+    constexpr size_t capacity = 1000;
+    constexpr int numKeys = 4 * capacity;
+
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    CacheEntry<IntKey, ValueType> entry(capacity);
+
+    // the consecutive keys are spread over all the shards, so every shard is filled up
+    for (int i = 0; i < numKeys; ++i) {
+        entry.getOrCreate({i}, builder);
+    }
+
+    auto stat = entry.getStatistics();
+    ASSERT_EQ(stat.misses, numKeys);
+    ASSERT_EQ(stat.evictions, numKeys - capacity);
+}
+
 TEST(CacheEntryTests, Empty) {
     using testing::_;
     using ValueType = std::shared_ptr<int>;
@@ -345,7 +395,11 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
     auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
     auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
 
-    std::vector<MultiCache> vecCache(numThreads, MultiCache(capacity));
+    // MultiCache holds a mutex, so the caches are constructed in place
+    std::deque<MultiCache> vecCache;
+    for (size_t i = 0; i < numThreads; ++i) {
+        vecCache.emplace_back(capacity);
+    }
 
     auto testRoutine = [&](MultiCache& cache) {
         //creating so we miss everytime
@@ -379,3 +433,137 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedCacheBuildsOnce) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    std::atomic<size_t> numBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        numBuilds++;
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    ASSERT_EQ(numBuilds, capacity);
+}
+
+TEST(MultiCacheTests, ShardedConcurrentAccess) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 4096;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 1000;
+
+    std::atomic<size_t> numBuilds{0};
+    auto intBuilder = [&](const IntKey& key) {
+        numBuilds++;
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&](size_t shift) {
+        for (int i = 0; i < numKeys; ++i) {
+            const int key = static_cast<int>((i + shift * 61) % numKeys);
+            auto intResult = cache.getOrCreate(IntKey{key}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, key);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    ASSERT_EQ(numBuilds, numKeys);
+    auto stat = cache.getStatistics();
+    ASSERT_EQ(stat.misses, numKeys);
+    ASSERT_EQ(stat.hits, numThreads * numKeys - numKeys);
+    ASSERT_EQ(stat.evictions, 0);
+}
+
+TEST(CacheEntryTests, BuilderDoesNotBlockOtherKeys) {
+    using ValueType = std::shared_ptr<int>;
+
+    // a small capacity gives a single shard, so both keys share the same lock
+    constexpr size_t capacity = 10;
+    CacheEntry<IntKey, ValueType> entry(capacity);
+
+    std::promise<void> slowBuildStarted;
+    std::promise<void> releaseSlowBuild;
+    auto releaseFuture = releaseSlowBuild.get_future();
+    auto slowBuilder = [&](const IntKey& key) {
+        slowBuildStarted.set_value();
+        releaseFuture.wait();
+        return std::make_shared<int>(key.data);
+    };
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    auto slowResult = std::async(std::launch::async, [&] { return entry.getOrCreate({1}, slowBuilder); });
+    slowBuildStarted.get_future().wait();
+
+    auto fastResult = std::async(std::launch::async, [&] { return entry.getOrCreate({2}, builder); });
+    ASSERT_EQ(fastResult.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    ASSERT_EQ(*fastResult.get().first, 2);
+
+    releaseSlowBuild.set_value();
+    auto result = slowResult.get();
+    ASSERT_EQ(*result.first, 1);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+}
+
+TEST(CacheEntryTests, BuilderUsesSameCache) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+    CacheEntry<IntKey, ValueType> entry(capacity);
+
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto nestedBuilder = [&](const IntKey& key) {
+        auto nested = entry.getOrCreate({key.data + 1}, builder);
+        return std::make_shared<int>(*nested.first + key.data);
+    };
+
+    auto result = entry.getOrCreate({1}, nestedBuilder);
+    ASSERT_EQ(*result.first, 3);
+    ASSERT_EQ(entry.getOrCreate({2}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+}
+
+TEST(CacheEntryTests, BuilderThrows) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+    CacheEntry<IntKey, ValueType> entry(capacity);
+
+    auto throwingBuilder = [&](const IntKey& key) -> ValueType { throw std::runtime_error("build failed"); };
+    auto builder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    ASSERT_THROW(entry.getOrCreate({1}, throwingBuilder), std::runtime_error);
+    auto result = entry.getOrCreate({1}, builder);
+    ASSERT_EQ(*result.first, 1);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+}
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <ngraph_transformations/op/fully_connected.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, FullyConnectedTest) {
+    auto activations = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto weights = ov::op::v0::Constant::create(element::f32, Shape{16, 32}, std::vector<float>(16 * 32, 0.f));
+    auto fc = std::make_shared<FullyConnectedNode>(activations, weights, Rank(3));
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 5, 32}, StaticShape{16, 32}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(fc.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 5, 16}));
+}
+
+TEST(StaticShapeInferenceTest, FullyConnectedOutputRankTest) {
+    auto activations = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto weights = ov::op::v0::Constant::create(element::f32, Shape{8, 4, 6}, std::vector<float>(8 * 4 * 6, 0.f));
+    auto fc = std::make_shared<FullyConnectedNode>(activations, weights, Rank(4));
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{3, 4, 6}, StaticShape{8, 4, 6}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(fc.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 1, 3, 8}));
+}
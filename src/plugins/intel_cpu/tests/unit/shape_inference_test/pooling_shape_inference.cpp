@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, MaxPoolV1Test) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto pool = std::make_shared<op::v1::MaxPool>(param, Strides{2, 2}, Shape{1, 1}, Shape{0, 0}, Shape{3, 3},
+                                                  op::RoundingType::FLOOR, op::PadType::EXPLICIT);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 16, 14, 15}},
+                             static_output_shapes = {StaticShape{}};
+    auto shape_infer = make_shape_inference(pool);
+    shape_infer->infer(static_input_shapes, static_output_shapes, {});
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 16, 7, 7}));
+    ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({1, 1}));
+    ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({0, 0}));
+}
+
+TEST(StaticShapeInferenceTest, MaxPoolV8SameUpperCeilTest) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1, -1});
+    auto pool = std::make_shared<op::v8::MaxPool>(param, Strides{2, 2, 1}, Strides{1, 2, 1}, Shape{0, 0, 0},
+                                                  Shape{0, 0, 0}, Shape{2, 2, 3}, op::RoundingType::CEIL,
+                                                  op::PadType::SAME_UPPER);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 8, 9, 10, 5}},
+                             static_output_shapes = {StaticShape{}, StaticShape{}};
+    auto shape_infer = make_shape_inference(pool);
+    shape_infer->infer(static_input_shapes, static_output_shapes, {});
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 8, 5, 5, 5}));
+    ASSERT_EQ(static_output_shapes[1], StaticShape({2, 8, 5, 5, 5}));
+    ASSERT_EQ(shape_infer->get_pads_begin(), CoordinateDiff({0, 0, 1}));
+    ASSERT_EQ(shape_infer->get_pads_end(), CoordinateDiff({1, 1, 1}));
+    // the attributes of the op are not updated by the static shape inference
+    ASSERT_EQ(pool->get_pads_begin(), Shape({0, 0, 0}));
+}
+
+TEST(StaticShapeInferenceTest, AvgPoolReusedOutputsTest) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto pool = std::make_shared<op::v1::AvgPool>(param, Strides{1}, Shape{0}, Shape{0}, Shape{2}, true,
+                                                  op::RoundingType::FLOOR, op::PadType::VALID);
+
+    std::vector<StaticShape> static_output_shapes;
+    auto shape_infer = make_shape_inference(pool);
+    shape_infer->infer({StaticShape{1, 3, 32}}, static_output_shapes, {});
+    ASSERT_EQ(static_output_shapes, std::vector<StaticShape>({StaticShape{1, 3, 31}}));
+    shape_infer->infer({StaticShape{4, 3, 8}}, static_output_shapes, {});
+    ASSERT_EQ(static_output_shapes, std::vector<StaticShape>({StaticShape{4, 3, 7}}));
+
+    ASSERT_THROW(shape_infer->infer({StaticShape{4, 3, 1}}, static_output_shapes, {}), NodeValidationFailure);
+}
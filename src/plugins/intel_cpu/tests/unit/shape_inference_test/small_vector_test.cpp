@@ -0,0 +1,184 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <utils/shape_inference/small_vector.hpp>
+
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+using Vector = SmallVector<int, 4>;
+
+bool isInline(const Vector& vec) {
+    const auto data = reinterpret_cast<const char*>(vec.data());
+    const auto self = reinterpret_cast<const char*>(&vec);
+    return data >= self && data < self + sizeof(vec);
+}
+
+std::vector<int> toStd(const Vector& vec) {
+    return std::vector<int>(vec.begin(), vec.end());
+}
+}  // namespace
+
+TEST(SmallVectorTest, GrowsFromInlineToHeap) {
+    Vector vec;
+    ASSERT_TRUE(vec.empty());
+    ASSERT_EQ(4, vec.capacity());
+    ASSERT_TRUE(isInline(vec));
+
+    for (int i = 0; i < 4; i++)
+        vec.push_back(i);
+    ASSERT_TRUE(isInline(vec));
+    ASSERT_EQ(4, vec.capacity());
+
+    vec.push_back(4);
+    ASSERT_FALSE(isInline(vec));
+    ASSERT_GE(vec.capacity(), 5);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), toStd(vec));
+
+    // the heap buffer is kept, as in std::vector
+    vec.clear();
+    ASSERT_TRUE(vec.empty());
+    ASSERT_FALSE(isInline(vec));
+}
+
+TEST(SmallVectorTest, PushBackOfOwnElement) {
+    Vector vec{1, 2, 3, 4};
+    // the reallocation must not invalidate the pushed value
+    vec.push_back(vec[0]);
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 1}), toStd(vec));
+}
+
+TEST(SmallVectorTest, Copy) {
+    const Vector inl{1, 2};
+    const Vector heap{1, 2, 3, 4, 5, 6};
+
+    Vector inlCopy(inl);
+    Vector heapCopy(heap);
+    ASSERT_EQ(inl, inlCopy);
+    ASSERT_EQ(heap, heapCopy);
+    ASSERT_TRUE(isInline(inlCopy));
+    ASSERT_NE(heap.data(), heapCopy.data());
+
+    // heap to inline, inline to heap
+    inlCopy = heap;
+    heapCopy = inl;
+    ASSERT_EQ(heap, inlCopy);
+    ASSERT_EQ(inl, heapCopy);
+
+    const Vector& self = inlCopy;
+    inlCopy = self;
+    ASSERT_EQ(heap, inlCopy);
+}
+
+TEST(SmallVectorTest, Move) {
+    Vector inl{1, 2};
+    Vector heap{1, 2, 3, 4, 5, 6};
+    const auto heapData = heap.data();
+
+    Vector inlMoved(std::move(inl));
+    Vector heapMoved(std::move(heap));
+    ASSERT_EQ((std::vector<int>{1, 2}), toStd(inlMoved));
+    ASSERT_TRUE(isInline(inlMoved));
+    // the heap buffer is taken over
+    ASSERT_EQ(heapData, heapMoved.data());
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 5, 6}), toStd(heapMoved));
+    // the moved from vectors are empty and usable
+    ASSERT_TRUE(inl.empty());
+    ASSERT_TRUE(heap.empty());
+    ASSERT_TRUE(isInline(heap));
+    heap.push_back(7);
+    ASSERT_EQ((std::vector<int>{7}), toStd(heap));
+
+    inlMoved = std::move(heapMoved);
+    ASSERT_EQ(heapData, inlMoved.data());
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 5, 6}), toStd(inlMoved));
+
+    Vector other{9};
+    swap(other, inlMoved);
+    ASSERT_EQ((std::vector<int>{9}), toStd(inlMoved));
+    ASSERT_EQ(heapData, other.data());
+}
+
+TEST(SmallVectorTest, Insert) {
+    Vector vec{1, 4};
+    auto it = vec.insert(vec.begin() + 1, {2, 3});
+    ASSERT_EQ(vec.begin() + 1, it);
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4}), toStd(vec));
+    ASSERT_TRUE(isInline(vec));
+
+    // grows to the heap
+    it = vec.insert(vec.end(), 2, 5);
+    ASSERT_EQ(vec.begin() + 4, it);
+    ASSERT_EQ((std::vector<int>{1, 2, 3, 4, 5, 5}), toStd(vec));
+
+    vec.insert(vec.begin(), 0);
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 5}), toStd(vec));
+
+    // the inserted values refer to the vector itself
+    Vector self{1, 2, 3};
+    self.insert(self.begin(), self[2]);
+    ASSERT_EQ((std::vector<int>{3, 1, 2, 3}), toStd(self));
+    self.insert(self.begin() + 1, self.begin(), self.end());
+    ASSERT_EQ((std::vector<int>{3, 3, 1, 2, 3, 1, 2, 3}), toStd(self));
+}
+
+TEST(SmallVectorTest, Erase) {
+    Vector vec{0, 1, 2, 3, 4, 5};
+    auto it = vec.erase(vec.begin() + 1);
+    ASSERT_EQ(vec.begin() + 1, it);
+    ASSERT_EQ((std::vector<int>{0, 2, 3, 4, 5}), toStd(vec));
+
+    it = vec.erase(vec.begin() + 1, vec.begin() + 3);
+    ASSERT_EQ(vec.begin() + 1, it);
+    ASSERT_EQ((std::vector<int>{0, 4, 5}), toStd(vec));
+
+    it = vec.erase(vec.begin() + 1, vec.end());
+    ASSERT_EQ(vec.end(), it);
+    ASSERT_EQ((std::vector<int>{0}), toStd(vec));
+
+    vec.erase(vec.begin(), vec.begin());
+    ASSERT_EQ((std::vector<int>{0}), toStd(vec));
+}
+
+TEST(SmallVectorTest, Resize) {
+    Vector vec;
+    vec.resize(3);
+    ASSERT_EQ((std::vector<int>{0, 0, 0}), toStd(vec));
+    ASSERT_TRUE(isInline(vec));
+
+    vec.resize(6, 7);
+    ASSERT_EQ((std::vector<int>{0, 0, 0, 7, 7, 7}), toStd(vec));
+    ASSERT_FALSE(isInline(vec));
+
+    vec.resize(2);
+    ASSERT_EQ((std::vector<int>{0, 0}), toStd(vec));
+
+    // the previously used elements are overwritten
+    vec.resize(4, 1);
+    ASSERT_EQ((std::vector<int>{0, 0, 1, 1}), toStd(vec));
+
+    Vector sized(5, 2);
+    ASSERT_EQ((std::vector<int>{2, 2, 2, 2, 2}), toStd(sized));
+    sized.assign(2, 3);
+    ASSERT_EQ((std::vector<int>{3, 3}), toStd(sized));
+}
+
+TEST(SmallVectorTest, Access) {
+    Vector vec{1, 2, 3};
+    ASSERT_EQ(1, vec.front());
+    ASSERT_EQ(3, vec.back());
+    ASSERT_EQ(2, vec.at(1));
+    ASSERT_THROW(vec.at(3), std::out_of_range);
+    ASSERT_EQ((std::vector<int>{3, 2, 1}), std::vector<int>(vec.rbegin(), vec.rend()));
+
+    vec.emplace_back(4);
+    vec.emplace(vec.begin(), 0);
+    vec.pop_back();
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), toStd(vec));
+    ASSERT_NE(vec, (Vector{0, 1, 2}));
+}
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+TEST(StaticShapeInferenceTest, TransposeTest) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto order = ov::op::v0::Constant::create(element::i64, Shape{4}, {0, 2, 3, 1});
+    auto transpose = std::make_shared<op::v1::Transpose>(param, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{1, 3, 16, 32}, StaticShape{4}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({1, 16, 32, 3}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeEmptyOrderTest) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto order = ov::op::v0::Constant::create(element::i64, Shape{0}, std::vector<int64_t>{});
+    auto transpose = std::make_shared<op::v1::Transpose>(param, order);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{0}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({4, 3, 2}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeOrderFromDataTest) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1});
+    auto order = std::make_shared<ov::op::v0::Parameter>(element::i32, PartialShape{3});
+    auto transpose = std::make_shared<op::v1::Transpose>(param, order);
+
+    int32_t order_data[] = {1, 0, 2};
+    std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>> constant_data;
+    constant_data[1] = std::make_shared<ngraph::runtime::HostTensor>(element::i32, Shape{3}, order_data);
+
+    std::vector<StaticShape> static_input_shapes = {StaticShape{2, 3, 4}, StaticShape{3}},
+                             static_output_shapes = {StaticShape{}};
+    shape_inference(transpose.get(), static_input_shapes, static_output_shapes, constant_data);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({3, 2, 4}));
+
+    order_data[1] = 1;
+    ASSERT_THROW(shape_inference(transpose.get(), static_input_shapes, static_output_shapes, constant_data),
+                 NodeValidationFailure);
+}
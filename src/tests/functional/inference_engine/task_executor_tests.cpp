@@ -2,7 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -187,6 +195,206 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, taskPostedByBusyStreamIsStolen) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> nestedStarted;
+    auto nestedFuture = nestedStarted.get_future().share();
+    // the nested task is put to the queue of the stream, which is blocked until the other stream takes it
+    auto f = async(taskExecutor, [&] {
+        taskExecutor->run([&] {
+            nestedStarted.set_value();
+        });
+        ASSERT_EQ(std::future_status::ready, nestedFuture.wait_for(std::chrono::seconds(10)));
+    });
+    f.wait();
+    ASSERT_NO_THROW(f.get());
+}
+
+TEST(CPUStreamsExecutorTests, higherPriorityTaskStartsFirst) {
+    CPUStreamsExecutor taskExecutor{
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+    std::promise<void> unblock;
+    auto unblockFuture = unblock.get_future().share();
+    std::promise<void> blocked;
+    taskExecutor.run([&] {
+        blocked.set_value();
+        unblockFuture.wait();
+    });
+    blocked.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::vector<std::future<void>> futures;
+    auto submit = [&](const std::string& name, int priority, bool withDeadline) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&, name] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+        });
+        futures.emplace_back(task->get_future());
+        TaskSchedulingHints hints;
+        hints.priority = priority;
+        if (withDeadline) {
+            hints.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        }
+        taskExecutor.runScheduled([task] {(*task)();}, hints);
+    };
+    submit("low", 0, false);
+    submit("medium", 1, false);
+    submit("medium_deadline", 1, true);
+    submit("high", 2, false);
+    unblock.set_value();
+    for (auto&& f : futures) f.wait();
+
+    ASSERT_EQ((std::vector<std::string>{"high", "medium_deadline", "medium", "low"}), order);
+}
+
+TEST(CPUStreamsExecutorTests, earliestDeadlineOfAllStreamsStartsFirst) {
+    CPUStreamsExecutor taskExecutor{
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+    // both stream threads are blocked, the first one is released after the tasks are queued
+    std::array<std::promise<void>, 2> unblock;
+    std::array<std::shared_future<void>, 2> unblockFutures{unblock[0].get_future().share(),
+                                                           unblock[1].get_future().share()};
+    std::array<std::promise<void>, 2> blocked;
+    for (int i = 0; i < 2; i++) {
+        taskExecutor.run([&, i] {
+            blocked[i].set_value();
+            unblockFutures[taskExecutor.GetStreamId()].wait();
+        });
+    }
+    for (auto&& b : blocked) b.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::vector<std::future<void>> futures;
+    auto submit = [&](const std::string& name, std::chrono::seconds deadline) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&, name] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+        });
+        futures.emplace_back(task->get_future());
+        TaskSchedulingHints hints;
+        hints.deadline = std::chrono::steady_clock::now() + deadline;
+        taskExecutor.runScheduled([task] {(*task)();}, hints);
+    };
+    // the external tasks are spread round-robin: the late one goes to the queue of the first stream,
+    // the early one to the queue of the second stream
+    submit("late", std::chrono::seconds(3600));
+    submit("early", std::chrono::seconds(1800));
+    unblock[0].set_value();
+    futures[0].wait();
+    futures[1].wait();
+    unblock[1].set_value();
+
+    ASSERT_EQ((std::vector<std::string>{"early", "late"}), order);
+}
+
+TEST(CPUStreamsExecutorTests, taskMissedDeadlineIsShed) {
+    CPUStreamsExecutor taskExecutor{
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+    std::promise<void> unblock;
+    auto unblockFuture = unblock.get_future().share();
+    std::promise<void> blocked;
+    taskExecutor.run([&] {
+        blocked.set_value();
+        unblockFuture.wait();
+    });
+    blocked.get_future().wait();
+
+    std::atomic<bool> taskExecuted{false};
+    std::promise<void> deadlineMissed;
+    TaskSchedulingHints hints;
+    hints.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+    hints.onDeadlineMissed = [&] {
+        deadlineMissed.set_value();
+    };
+    taskExecutor.runScheduled([&] {
+        taskExecuted = true;
+    }, hints);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    unblock.set_value();
+
+    ASSERT_EQ(std::future_status::ready, deadlineMissed.get_future().wait_for(std::chrono::seconds(10)));
+    ASSERT_FALSE(taskExecuted);
+}
+
+// The stream threads are bound by their stream ids, so the ids must be the thread indices whichever thread
+// creates its stream first
+TEST(CPUStreamsExecutorTests, streamIdsOfStreamThreadsAreTheirIndices) {
+    const int streams = 2;
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    // the stream of the external thread is created before any stream thread has executed a task
+    int externalStreamId = -1;
+    taskExecutor->Execute([&] {
+        externalStreamId = taskExecutor->GetStreamId();
+    });
+    ASSERT_GE(externalStreamId, streams);
+
+    std::mutex mutex;
+    std::set<int> streamIds;
+    std::vector<Future> futures;
+    for (int i = 0; i < 100; i++) {
+        futures.emplace_back(async(taskExecutor, [&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            streamIds.insert(taskExecutor->GetStreamId());
+        }));
+    }
+    for (auto&& f : futures) f.wait();
+    for (auto streamId : streamIds) {
+        ASSERT_GE(streamId, 0);
+        ASSERT_LT(streamId, streams);
+    }
+}
+
+// Benchmark of the latency between run() and the start of the task for the producers posting small tasks
+// concurrently. It depends on the machine and its load, so it only reports the percentiles and is run explicitly
+// with --gtest_also_run_disabled_tests --gtest_filter=*enqueueToStartLatency*
+TEST(CPUStreamsExecutorTests, DISABLED_enqueueToStartLatency) {
+    const int streams = std::max(2, getNumberOfCPUCores());
+    const int producers = 4;
+    const int tasksPerProducer = 2000;
+    std::vector<std::vector<double>> latencies(producers);
+    {
+        CPUStreamsExecutor taskExecutor{
+            IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            latencies[p].resize(tasksPerProducer, -1.0);
+            threads.emplace_back([&, p] {
+                std::vector<Future> futures;
+                for (int i = 0; i < tasksPerProducer; i++) {
+                    auto start = std::chrono::steady_clock::now();
+                    auto task = std::make_shared<std::packaged_task<void()>>([&, p, i, start] {
+                        latencies[p][i] =
+                            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+                    });
+                    futures.emplace_back(task->get_future());
+                    taskExecutor.run([task] {(*task)();});
+                    // keeps the executor loaded but not saturated, as the infer requests do
+                    if (i % streams == streams - 1) {
+                        for (auto&& f : futures) f.wait();
+                        futures.clear();
+                    }
+                }
+                for (auto&& f : futures) f.wait();
+            });
+        }
+        for (auto&& thread : threads) thread.join();
+    }
+    std::vector<double> all;
+    for (auto&& l : latencies) all.insert(all.end(), l.begin(), l.end());
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<size_t>(producers * tasksPerProducer));
+    ASSERT_GE(all.front(), 0.0) << "some tasks were not executed";
+    for (auto&& percentile : {50, 90, 99}) {
+        const auto latency = all[all.size() * percentile / 100];
+        ::testing::Test::RecordProperty("p" + std::to_string(percentile) + "_us", std::to_string(latency));
+        std::cout << "enqueue to start latency p" << percentile << ": " << latency << " us" << std::endl;
+    }
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
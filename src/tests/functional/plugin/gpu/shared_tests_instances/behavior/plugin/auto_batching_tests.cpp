@@ -33,6 +33,33 @@ INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_GPU, AutoBatching_Test_DetectionOutp
                                  ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test_DetectionOutput::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_GPU, AutoBatching_Test_PartialBatch,
+                         ::testing::Combine(
+                                 ::testing::Values(CommonTestUtils::DEVICE_GPU),
+                                 ::testing::ValuesIn(get_vs_set),
+                                 ::testing::ValuesIn(num_streams),
+                                 ::testing::Values(3, 9),
+                                 ::testing::Values(8)),
+                         AutoBatching_Test_PartialBatch::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_GPU, AutoBatching_Test_Gather,
+                         ::testing::Combine(
+                                 ::testing::Values(CommonTestUtils::DEVICE_GPU),
+                                 ::testing::Values(false),
+                                 ::testing::ValuesIn(num_streams),
+                                 ::testing::Values(3, 8, 9),
+                                 ::testing::Values(8)),
+                         AutoBatching_Test_Gather::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatching_GPU, AutoBatching_Test_AdaptiveTimeout,
+                         ::testing::Combine(
+                                 ::testing::Values(CommonTestUtils::DEVICE_GPU),
+                                 ::testing::ValuesIn(get_vs_set),
+                                 ::testing::ValuesIn(num_streams),
+                                 ::testing::Values(3),
+                                 ::testing::Values(8)),
+                         AutoBatching_Test_AdaptiveTimeout::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(
         smoke_AutoBatching_GPU,
         DefaultConfigurationTest,
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <string>
 #include <utility>
 #include <vector>
@@ -51,7 +52,24 @@ protected:
     size_t num_batch;
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
 
-    void TestAutoBatch() {
+    std::map<std::string, std::string> GetConfig(size_t timeout) const {
+        std::map<std::string, std::string> config;
+        if (target_device.find("GPU") != std::string::npos)
+            config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
+        if (target_device.find("CPU") != std::string::npos) {
+            config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
+            config[CONFIG_KEY(ENFORCE_BF16)] = CONFIG_VALUE(NO);
+        }
+        config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(timeout);
+        return config;
+    }
+
+    std::string GetBatchDevice() const {
+        return std::string(CommonTestUtils::DEVICE_BATCH) + ":" + target_device + "(" + std::to_string(num_batch) +
+               ")";
+    }
+
+    void TestAutoBatch(int niter = 1) {
         std::vector<InferenceEngine::CNNNetwork> nets;
         for (auto &fn_ptr : fn_ptrs) {
             nets.push_back(CNNNetwork(fn_ptr));
@@ -69,18 +87,8 @@ protected:
             for (auto n : inputs) {
                 n.second->setPrecision(Precision::FP32);
             }
-            std::map<std::string, std::string> config;
-            if (target_device.find("GPU") != std::string::npos)
-                config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
-            if (target_device.find("CPU") != std::string::npos) {
-                config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(num_streams);
-                config[CONFIG_KEY(ENFORCE_BF16)] = CONFIG_VALUE(NO);
-            }
             // minimize timeout to reduce test time
-            config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
-            auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
-                                                    target_device + "(" + std::to_string(num_batch) + ")",
-                                               config);
+            auto exec_net_ref = ie.LoadNetwork(net, GetBatchDevice(), GetConfig(1));
 
             auto network_outputs = net.getOutputsInfo();
             ASSERT_EQ(network_outputs.size(), 1) << " Auto-Batching tests use networks with single output";
@@ -118,8 +126,8 @@ protected:
             }
         }
 
-        const int niter = 1;
-        for (int i = 0; i < niter; i++) {
+        auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+        for (int iter = 0; iter < niter; iter++) {
             for (auto ir : irs) {
                 ir.StartAsync();
             }
@@ -127,16 +135,117 @@ protected:
             for (auto ir : irs) {
                 ir.Wait(InferRequest::RESULT_READY);
             }
+
+            for (size_t i = 0; i < irs.size(); ++i) {
+                const auto &refBuffer = ref[i].data();
+                ASSERT_EQ(outElementsCount[i], irs[i].GetBlob(outputs[i])->size());
+                FuncTestUtils::compareRawBuffers(irs[i].GetBlob(outputs[i])->buffer().as<float *>(),
+                                                 reinterpret_cast<const float *>(refBuffer), outElementsCount[i],
+                                                 outElementsCount[i],
+                                                 thr);
+            }
         }
+    }
+};
+
+// The requests that do not fill the batch are executed as a partial batch or in the batch1 mode, whichever was
+// observed to be faster, so several rounds are needed to go through both
+class AutoBatching_Test_PartialBatch : public AutoBatching_Test {};
+
+// The user-set input blobs are gathered into the batch, the data is changed between the rounds to make sure the
+// gathered slots are never stale, whether the request goes with the full batch or falls back
+class AutoBatching_Test_Gather : public AutoBatching_Test {
+protected:
+    void TestGather() {
+        auto fn_ptr = fn_ptrs.front();
+        auto net = CNNNetwork(fn_ptr);
+        auto inputs = net.getInputsInfo();
+        for (auto n : inputs) {
+            n.second->setPrecision(Precision::FP32);
+        }
+        auto ie = InferenceEngine::Core();
+        // minimize timeout to reduce test time
+        auto exec_net = ie.LoadNetwork(net, GetBatchDevice(), GetConfig(1));
+        const auto output = net.getOutputsInfo().begin()->first;
+        const auto outElementsCount = ngraph::shape_size(fn_ptr->get_output_shape(0));
+
+        std::vector<InferRequest> irs;
+        for (size_t j = 0; j < num_requests; j++)
+            irs.push_back(exec_net.CreateInferRequest());
 
         auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
-        for (size_t i = 0; i < irs.size(); ++i) {
-            const auto &refBuffer = ref[i].data();
-            ASSERT_EQ(outElementsCount[i], irs[i].GetBlob(outputs[i])->size());
-            FuncTestUtils::compareRawBuffers(irs[i].GetBlob(outputs[i])->buffer().as<float *>(),
-                                             reinterpret_cast<const float *>(refBuffer), outElementsCount[i],
-                                             outElementsCount[i],
-                                             thr);
+        const int niter = 3;
+        for (int iter = 0; iter < niter; iter++) {
+            std::vector<std::vector<uint8_t>> ref;
+            for (size_t j = 0; j < num_requests; j++) {
+                std::vector<std::vector<uint8_t>> inData;
+                for (auto n : inputs) {
+                    auto blob = FuncTestUtils::createAndFillBlob(n.second->getTensorDesc(), 10,
+                                                                 static_cast<int32_t>(iter * num_requests + j));
+                    irs[j].SetBlob(n.first, blob);
+                    const auto inBlobBuf = blob->cbuffer().as<uint8_t*>();
+                    inData.push_back(std::vector<uint8_t>(inBlobBuf, inBlobBuf + blob->byteSize()));
+                }
+                ref.push_back(ngraph::helpers::interpreterFunction(fn_ptr, {inData}).front().second);
+            }
+
+            for (auto ir : irs) {
+                ir.StartAsync();
+            }
+            for (auto ir : irs) {
+                ir.Wait(InferRequest::RESULT_READY);
+            }
+
+            for (size_t j = 0; j < num_requests; j++) {
+                ASSERT_EQ(outElementsCount, irs[j].GetBlob(output)->size());
+                FuncTestUtils::compareRawBuffers(irs[j].GetBlob(output)->buffer().as<float*>(),
+                                                 reinterpret_cast<const float*>(ref[j].data()), outElementsCount,
+                                                 outElementsCount,
+                                                 thr);
+            }
+        }
+    }
+};
+
+// The batch collection timeout adapts to the requests arrival interval, so once a burst of requests (that never fills
+// the batch) is over, it is executed without waiting for the whole configured timeout
+class AutoBatching_Test_AdaptiveTimeout : public AutoBatching_Test {
+protected:
+    void TestAdaptiveTimeout() {
+        const size_t timeout = 3000;
+        auto net = CNNNetwork(fn_ptrs.front());
+        for (auto n : net.getInputsInfo()) {
+            n.second->setPrecision(Precision::FP32);
+        }
+        auto ie = InferenceEngine::Core();
+        auto exec_net = ie.LoadNetwork(net, GetBatchDevice(), GetConfig(timeout));
+
+        std::vector<InferRequest> irs;
+        for (size_t j = 0; j < num_requests; j++) {
+            irs.push_back(exec_net.CreateInferRequest());
+            if (!use_get_blob) {
+                for (auto n : net.getInputsInfo())
+                    irs.back().SetBlob(n.first, FuncTestUtils::createAndFillBlob(n.second->getTensorDesc()));
+            }
+        }
+
+        const int niter = 4;
+        for (int iter = 0; iter < niter; iter++) {
+            const auto start = std::chrono::steady_clock::now();
+            for (auto ir : irs) {
+                ir.StartAsync();
+            }
+            for (auto ir : irs) {
+                ir.Wait(InferRequest::RESULT_READY);
+            }
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            // the first burst is used to measure the arrival interval. A burst that waits for the configured timeout
+            // takes at least the timeout, while the burst itself is a few milliseconds of inference, so the whole
+            // timeout is left as the margin for a loaded machine
+            if (iter) {
+                EXPECT_LT(elapsed, static_cast<int64_t>(timeout)) << " on the iteration " << iter;
+            }
         }
     }
 };
@@ -168,4 +277,20 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
+TEST_P(AutoBatching_Test_PartialBatch, compareAutoBatchingToSingleBatch) {
+    if (num_requests % num_batch == 0)
+        GTEST_SKIP() << "The requests fill the batches";
+    TestAutoBatch(8);
+}
+
+TEST_P(AutoBatching_Test_Gather, compareAutoBatchingToSingleBatch) {
+    TestGather();
+}
+
+TEST_P(AutoBatching_Test_AdaptiveTimeout, burstIsNotDelayedByTimeout) {
+    if (num_requests < 2 || num_requests >= num_batch)
+        GTEST_SKIP() << "The burst of requests has to partially fill a single batch";
+    TestAdaptiveTimeout();
+}
+
 }  // namespace AutoBatchingTests
\ No newline at end of file
@@ -25,6 +25,14 @@ typedef std::tuple<
         std::string                  // Target Device
 > AddConstParams;
 
+typedef std::tuple<
+        InputShape,                  // Input 0 Shape
+        InputShape,                  // Input 1 Shape
+        size_t,                      // Expected num nodes
+        size_t,                      // Expected num subgraphs
+        std::string                  // Target Device
+> AddDynamicParams;
+
 class Add : public testing::WithParamInterface<ov::test::snippets::AddParams>,
             virtual public ov::test::SnippetsTestsCommon {
 public:
@@ -47,6 +55,15 @@ protected:
     void SetUp() override;
 };
 
+// The input shapes are changed between the inferences, the kernel generated for a shape seen before is reused
+class AddSinhDynamic : public testing::WithParamInterface<ov::test::snippets::AddDynamicParams>,
+                       virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddDynamicParams> obj);
+protected:
+    void SetUp() override;
+};
+
 } // namespace snippets
 } // namespace test
 } // namespace ov
\ No newline at end of file
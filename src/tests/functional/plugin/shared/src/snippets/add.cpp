@@ -66,6 +66,41 @@ void AddSinhConst::SetUp() {
     function = f.getOriginal();
 }
 
+std::string AddSinhDynamic::getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddDynamicParams> obj) {
+    InputShape inputShapes0, inputShapes1;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    std::tie(inputShapes0, inputShapes1, num_nodes, num_subgraphs, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "IS[0]=" << CommonTestUtils::partialShape2str({inputShapes0.first}) << "_";
+    result << "TS[0]=";
+    for (const auto& shape : inputShapes0.second)
+        result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+    result << "IS[1]=" << CommonTestUtils::partialShape2str({inputShapes1.first}) << "_";
+    result << "TS[1]=";
+    for (const auto& shape : inputShapes1.second)
+        result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void AddSinhDynamic::SetUp() {
+    InputShape inputShape0, inputShape1;
+    std::tie(inputShape0, inputShape1, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+    init_input_shapes({inputShape0, inputShape1});
+
+    // the functions builders accept static shapes only
+    auto data0 = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(element::f32, inputDynamicShapes[1]);
+    auto sin0 = std::make_shared<op::v0::Sinh>(data0);
+    auto sin1 = std::make_shared<op::v0::Sinh>(data1);
+    auto add = std::make_shared<op::v1::Add>(sin0, sin1);
+    function = std::make_shared<ov::Model>(NodeVector{add}, ParameterVector{data0, data1});
+}
+
 TEST_P(Add, CompareWithRefImpl) {
     run();
     validateNumSubgraphs();
@@ -81,6 +116,11 @@ TEST_P(AddSinhConst, CompareWithRefImpl) {
     validateNumSubgraphs();
 }
 
+TEST_P(AddSinhDynamic, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
 } // namespace snippets
 } // namespace test
 } // namespace ov
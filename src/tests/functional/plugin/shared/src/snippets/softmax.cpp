@@ -0,0 +1,72 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "snippets/softmax.hpp"
+#include "subgraph_softmax.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string SoftmaxSinh::getTestCaseName(testing::TestParamInfo<ov::test::snippets::SoftmaxParams> obj) {
+    ov::Shape inputShapes;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    std::tie(inputShapes, num_nodes, num_subgraphs, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes) << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void SoftmaxSinh::SetUp() {
+    ov::Shape inputShape;
+    std::tie(inputShape, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+    init_input_shapes({{{}, {inputShape, }}});
+
+    auto f = ov::test::snippets::SoftmaxSinhFunction({inputShape});
+    function = f.getOriginal();
+}
+
+std::string AddLayerNormSinh::getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddLayerNormParams> obj) {
+    ov::Shape inputShapes0, inputShapes1;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    std::tie(inputShapes0, inputShapes1, num_nodes, num_subgraphs, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes0) << "_";
+    result << "IS[1]=" << CommonTestUtils::vec2str(inputShapes1) << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void AddLayerNormSinh::SetUp() {
+    ov::Shape inputShape0, inputShape1;
+    std::tie(inputShape0, inputShape1, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+    init_input_shapes({{{}, {inputShape0, }}, {{}, {inputShape1, }}});
+
+    auto f = ov::test::snippets::AddLayerNormSinhFunction({inputShape0, inputShape1});
+    function = f.getOriginal();
+}
+
+TEST_P(SoftmaxSinh, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(AddLayerNormSinh, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
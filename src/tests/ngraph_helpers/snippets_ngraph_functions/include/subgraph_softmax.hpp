@@ -0,0 +1,55 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/ngraph.hpp"
+#include "./snippets_helpers.hpp"
+
+/* This file contains definitions of functions (models) with ops that reduce data along the innermost dimension
+ * (Softmax, MVN), which are decomposed by snippets into element-wise ops and reductions.
+ * All the functions are expected to be direct descendants of SnippetsFunctionBase, so their constructors take only
+ * one (inputShapes) argument.
+ */
+
+namespace ov {
+namespace test {
+namespace snippets {
+/// Softmax along the innermost dimension.
+/// Tokenized simply by starting subgraph.
+//   in1
+//   Sinh
+//  Softmax
+//  Result
+// todo: remove Sinh once "no subgraph after input" limitation is relaxed
+class SoftmaxSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit SoftmaxSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+/// Residual Add followed by LayerNorm (MVN along the innermost dimension with scale and shift).
+/// The whole block is tokenized into a single subgraph.
+//   in1       in2
+//   Sinh      Sinh
+//        Add
+//        MVN
+//      Multiply   (gamma)
+//        Add      (beta)
+//      Result
+// todo: remove Sinh once "no subgraph after input" limitation is relaxed
+class AddLayerNormSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit AddLayerNormSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        NGRAPH_CHECK(input_shapes.size() == 2, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,38 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_softmax.hpp"
+#include "common_test_utils/data_utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::shared_ptr<ov::Model> SoftmaxSinhFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh0 = std::make_shared<ov::op::v0::Sinh>(data0);
+    auto softmax = std::make_shared<op::v8::Softmax>(sinh0, -1);
+    return std::make_shared<ov::Model>(NodeVector{softmax}, ParameterVector{data0});
+}
+std::shared_ptr<ov::Model> AddLayerNormSinhFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    auto sinh0 = std::make_shared<ov::op::v0::Sinh>(data0);
+    auto sinh1 = std::make_shared<ov::op::v0::Sinh>(data1);
+    auto add = std::make_shared<op::v1::Add>(sinh0, sinh1);
+    auto axes = op::v0::Constant::create(ov::element::i64, Shape{1}, {-1});
+    auto mvn = std::make_shared<op::v6::MVN>(add, axes, true, 1e-5f, op::MVNEpsMode::INSIDE_SQRT);
+    const Shape params_shape{input_shapes[0].back()};
+    auto gamma = std::make_shared<op::v0::Constant>(precision, params_shape,
+                                                    CommonTestUtils::generate_float_numbers(shape_size(params_shape), 0.5f, 1.5f));
+    auto beta = std::make_shared<op::v0::Constant>(precision, params_shape,
+                                                   CommonTestUtils::generate_float_numbers(shape_size(params_shape), -1.f, 1.f));
+    auto mul = std::make_shared<op::v1::Multiply>(mvn, gamma);
+    auto shift = std::make_shared<op::v1::Add>(mul, beta);
+    return std::make_shared<ov::Model>(NodeVector{shift}, ParameterVector{data0, data1});
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <deque>
+#include <new>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -21,6 +26,30 @@ using namespace std;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+std::atomic<bool> countAllocations{false};
+std::atomic<std::size_t> allocations{0};
+}  // namespace
+
+// counts the allocations of all the threads while the flag is set
+void* operator new(std::size_t size) {
+    if (countAllocations.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
 struct DeferedExecutor : public ITaskExecutor {
     using Ptr = std::shared_ptr<DeferedExecutor>;
     DeferedExecutor() = default;
@@ -194,3 +223,86 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, callbackCanRestartRequest) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(2).WillOnce(Throw(std::exception())).WillOnce(Return());
+    int callbackCalls = 0;
+    testRequest->SetCallback([&](std::exception_ptr exceptionPtr) {
+        if (0 == callbackCalls++) {
+            ASSERT_NE(nullptr, exceptionPtr);
+            testRequest->StartAsync();
+        } else {
+            ASSERT_EQ(nullptr, exceptionPtr);
+        }
+    });
+    testRequest->StartAsync();
+    taskExecutor->executeAll();
+    ASSERT_EQ(2, callbackCalls);
+    ASSERT_EQ(StatusCode::OK, testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+// SetProperty
+TEST_F(InferRequestThreadSafeDefaultTests, requestMissedDeadlineIsCancelled) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+    ASSERT_NO_THROW(testRequest->SetProperty({{ov::hint::request_deadline.name(), int64_t{1}}}));
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    taskExecutor->executeAll();
+    EXPECT_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY), InferCancelled);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, requestWithoutDeadlineIsNotCancelled) {
+    auto taskExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<AsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+    ASSERT_NO_THROW(testRequest->SetProperty({{ov::hint::request_priority.name(), ov::hint::Priority::HIGH},
+                                              {ov::hint::request_deadline.name(), int64_t{0}}}));
+    testRequest->StartAsync();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    taskExecutor->executeAll();
+    ASSERT_NO_THROW(testRequest->Wait(InferRequest::WaitMode::RESULT_READY));
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, throwOnUnsupportedProperty) {
+    ASSERT_THROW(testRequest->SetProperty({{"UNSUPPORTED_KEY", 1}}), NotFound);
+    ASSERT_THROW(testRequest->SetProperty({{ov::hint::request_deadline.name(), int64_t{-1}}}), Exception);
+}
+
+// StartAsync and Wait in the steady state
+struct NoOpInferRequest : public IInferRequestInternal {
+    NoOpInferRequest() : IInferRequestInternal(InputsDataMap{}, OutputsDataMap{}) {}
+    void InferImpl() override {}
+    void checkBlobs() override {}
+};
+
+TEST(InferRequestThreadSafeDefaultAllocationTests, startAsyncAndWaitDoNotAllocate) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"startAsyncAndWaitDoNotAllocate", 1, 1});
+    auto request = std::make_shared<AsyncInferRequestThreadSafeDefault>(std::make_shared<NoOpInferRequest>(),
+                                                                        executor, executor);
+    auto countInferenceAllocations = [&] {
+        // the first inferences create the thread local objects of the executor
+        for (int i = 0; i < 16; ++i) {
+            request->StartAsync();
+            request->Wait(InferRequest::WaitMode::RESULT_READY);
+        }
+        allocations = 0;
+        countAllocations = true;
+        for (int i = 0; i < 1000; ++i) {
+            request->StartAsync();
+            request->Wait(InferRequest::WaitMode::RESULT_READY);
+        }
+        countAllocations = false;
+        return allocations.load();
+    };
+    EXPECT_EQ(0u, countInferenceAllocations());
+
+    // the stages are passed with the scheduling hints, the deadline is not missed
+    request->SetProperty({{ov::hint::request_priority.name(), ov::hint::Priority::HIGH},
+                          {ov::hint::request_deadline.name(), int64_t{3600} * 1000 * 1000}});
+    EXPECT_EQ(0u, countInferenceAllocations());
+}
@@ -403,6 +403,42 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static CNNNetwork createNetworkWithWeights(const std::vector<float>& weights1, const std::vector<float>& weights2) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{weights1.size()});
+    auto mul_constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{weights1.size()}, weights1);
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(data, mul_constant);
+    auto add_constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{weights2.size()}, weights2);
+    auto add = std::make_shared<ngraph::opset6::Add>(mul, add_constant);
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithSwappedWeights) {
+    const std::vector<float> weights1(16, 1.f);
+    const std::vector<float> weights2(16, 2.f);
+    auto net1 = createNetworkWithWeights(weights1, weights2);
+    auto net2 = createNetworkWithWeights(weights2, weights1);
+    auto net3 = createNetworkWithWeights(weights1, weights2);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+// Weights bigger than a hash chunk are hashed in parallel, each of the chunks must contribute to the hash
+TEST(NetworkContext_CNNNetwork, HashWithBigWeights) {
+    std::vector<float> weights1(1 << 20, 1.f);
+    const std::vector<float> weights2(1 << 20, 2.f);
+    auto net1 = createNetworkWithWeights(weights1, weights2);
+    auto net2 = createNetworkWithWeights(weights1, weights2);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    weights1.back() = 3.f;
+    auto net3 = createNetworkWithWeights(weights1, weights2);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();